@@ -0,0 +1,243 @@
+{
+  "targets": [
+    {
+      'target_name': 'nertc-marshal-bench',
+      'include_dirs': [
+      '../shared',
+      './fake_sdk'
+      ],
+      'sources': [
+        './marshal_bench.cpp',
+        '../nertc_sdk_node/nertc_node_engine_helper.cpp',
+        '../nertc_sdk_node/nertc_node_engine_helper.h',
+        '../nertc_sdk_node/nertc_node_stats_template.cpp',
+        '../nertc_sdk_node/nertc_node_stats_template.h',
+        '../shared/sdk_helper/nim_node_helper.h',
+        '../shared/sdk_helper/nim_node_helper.cpp',
+        '../shared/sdk_helper/nim_node_key_cache.h',
+        '../shared/sdk_helper/nim_node_key_cache.cpp'
+      ],
+      'conditions': [
+        [
+          'OS=="win"',
+          {
+            'defines': [
+              'WIN32',
+              'WIN32_LEAN_AND_MEAN'
+            ],
+            'msvs_settings': {
+              'VCCLCompilerTool': {
+                'AdditionalOptions': [
+                  '/utf-8'
+                ]
+              }
+            }
+          }
+        ]
+      ]
+    },
+    {
+      'target_name': 'nertc-mock-engine',
+      'include_dirs': [
+      '../shared',
+      '../shared/libyuv/include',
+      './fake_sdk'
+      ],
+      'sources': [
+        './mock_engine.cpp',
+        './fake_sdk/fake_rtc_engine.cpp',
+        './fake_sdk/fake_rtc_engine.h',
+        '../nertc_sdk_node/nertc_node_engine.cpp',
+        '../nertc_sdk_node/nertc_node_engine.h',
+        '../nertc_sdk_node/nertc_node_engine_event_handler.cpp',
+        '../nertc_sdk_node/nertc_node_engine_event_handler.h',
+        '../nertc_sdk_node/nertc_node_engine_helper.cpp',
+        '../nertc_sdk_node/nertc_node_engine_helper.h',
+        '../nertc_sdk_node/nertc_node_latency_histogram.cpp',
+        '../nertc_sdk_node/nertc_node_latency_histogram.h',
+        '../nertc_sdk_node/nertc_node_live_stream_cache.cpp',
+        '../nertc_sdk_node/nertc_node_live_stream_cache.h',
+        '../nertc_sdk_node/nertc_node_render_governor.cpp',
+        '../nertc_sdk_node/nertc_node_render_governor.h',
+        '../nertc_sdk_node/nertc_node_sei_queue.cpp',
+        '../nertc_sdk_node/nertc_node_sei_queue.h',
+        '../nertc_sdk_node/nertc_node_sei_sender.cpp',
+        '../nertc_sdk_node/nertc_node_sei_sender.h',
+        '../nertc_sdk_node/nertc_node_stats_snapshot.cpp',
+        '../nertc_sdk_node/nertc_node_stats_snapshot.h',
+        '../nertc_sdk_node/nertc_node_stats_template.cpp',
+        '../nertc_sdk_node/nertc_node_stats_template.h',
+        '../nertc_sdk_node/nertc_node_video_frame_provider.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_provider.h',
+        '../nertc_sdk_node/nertc_node_video_frame_copy.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_copy.h',
+        '../nertc_sdk_node/nertc_node_video_frame_sink.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_sink.h',
+        '../nertc_sdk_node/nertc_node_video_quality_probe.cpp',
+        '../nertc_sdk_node/nertc_node_video_quality_probe.h',
+        '../shared/sdk_helper/nim_node_helper.h',
+        '../shared/sdk_helper/nim_node_helper.cpp',
+        '../shared/sdk_helper/nim_node_key_cache.h',
+        '../shared/sdk_helper/nim_node_key_cache.cpp',
+        '../shared/sdk_helper/nim_node_async_queue.h',
+        '../shared/sdk_helper/nim_node_async_queue.cpp',
+        '../shared/sdk_helper/nim_event_handler.h',
+        '../shared/sdk_helper/nim_event_handler.cpp',
+        '../shared/sdk_helper/superfasthash.cpp',
+        '../shared/libyuv/source/compare_common.cc',
+        '../shared/libyuv/source/compare.cc',
+        '../shared/libyuv/source/convert_argb.cc',
+        '../shared/libyuv/source/convert_from_argb.cc',
+        '../shared/libyuv/source/convert_from.cc',
+        '../shared/libyuv/source/convert_jpeg.cc',
+        '../shared/libyuv/source/convert_to_argb.cc',
+        '../shared/libyuv/source/convert_to_i420.cc',
+        '../shared/libyuv/source/convert.cc',
+        '../shared/libyuv/source/cpu_id.cc',
+        '../shared/libyuv/source/mjpeg_decoder.cc',
+        '../shared/libyuv/source/mjpeg_validate.cc',
+        '../shared/libyuv/source/planar_functions.cc',
+        '../shared/libyuv/source/rotate_any.cc',
+        '../shared/libyuv/source/rotate_argb.cc',
+        '../shared/libyuv/source/rotate_common.cc',
+        '../shared/libyuv/source/rotate.cc',
+        '../shared/libyuv/source/row_any.cc',
+        '../shared/libyuv/source/row_common.cc',
+        '../shared/libyuv/source/scale_any.cc',
+        '../shared/libyuv/source/scale_argb.cc',
+        '../shared/libyuv/source/scale_common.cc',
+        '../shared/libyuv/source/scale.cc',
+        '../shared/libyuv/source/video_common.cc'
+      ],
+      'conditions': [
+        [
+          'OS=="win"',
+          {
+            'defines': [
+              'WIN32',
+              'WIN32_LEAN_AND_MEAN'
+            ],
+            'msvs_settings': {
+              'VCCLCompilerTool': {
+                'AdditionalOptions': [
+                  '/utf-8'
+                ]
+              }
+            },
+            'sources': [
+              '../shared/util/windows_helper.h',
+              '../shared/util/windows_helper.cpp',
+              '../shared/util/string_util.h',
+              '../shared/util/string_util.cpp',
+              '../shared/util/ConvertUTF.c',
+              '../shared/util/ConvertUTF.h',
+              '../shared/libyuv/source/compare_win.cc',
+              '../shared/libyuv/source/rotate_win.cc',
+              '../shared/libyuv/source/row_win.cc',
+              '../shared/libyuv/source/scale_win.cc'
+            ]
+          }
+        ],
+        [
+          'OS!="win"',
+          {
+            'sources': [
+              '../shared/libyuv/source/compare_gcc.cc',
+              '../shared/libyuv/source/rotate_gcc.cc',
+              '../shared/libyuv/source/row_gcc.cc',
+              '../shared/libyuv/source/scale_gcc.cc'
+            ]
+          }
+        ]
+      ]
+    },
+    {
+      'target_name': 'nertc-transport-bench',
+      'include_dirs': [
+      '../shared',
+      '../shared/libyuv/include',
+      './fake_sdk'
+      ],
+      'sources': [
+        './transport_bench.cpp',
+        '../nertc_sdk_node/nertc_node_latency_histogram.cpp',
+        '../nertc_sdk_node/nertc_node_latency_histogram.h',
+        '../nertc_sdk_node/nertc_node_render_governor.cpp',
+        '../nertc_sdk_node/nertc_node_render_governor.h',
+        '../nertc_sdk_node/nertc_node_video_frame_provider.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_provider.h',
+        '../nertc_sdk_node/nertc_node_video_frame_copy.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_copy.h',
+        '../nertc_sdk_node/nertc_node_video_frame_sink.cpp',
+        '../nertc_sdk_node/nertc_node_video_frame_sink.h',
+        '../nertc_sdk_node/nertc_node_video_quality_probe.cpp',
+        '../nertc_sdk_node/nertc_node_video_quality_probe.h',
+        '../shared/sdk_helper/nim_node_helper.h',
+        '../shared/sdk_helper/nim_node_helper.cpp',
+        '../shared/sdk_helper/nim_node_key_cache.h',
+        '../shared/sdk_helper/nim_node_key_cache.cpp',
+        '../shared/sdk_helper/nim_node_async_queue.h',
+        '../shared/sdk_helper/nim_node_async_queue.cpp',
+        '../shared/libyuv/source/compare_common.cc',
+        '../shared/libyuv/source/compare.cc',
+        '../shared/libyuv/source/convert_argb.cc',
+        '../shared/libyuv/source/convert_from_argb.cc',
+        '../shared/libyuv/source/convert_from.cc',
+        '../shared/libyuv/source/convert_jpeg.cc',
+        '../shared/libyuv/source/convert_to_argb.cc',
+        '../shared/libyuv/source/convert_to_i420.cc',
+        '../shared/libyuv/source/convert.cc',
+        '../shared/libyuv/source/cpu_id.cc',
+        '../shared/libyuv/source/mjpeg_decoder.cc',
+        '../shared/libyuv/source/mjpeg_validate.cc',
+        '../shared/libyuv/source/planar_functions.cc',
+        '../shared/libyuv/source/rotate_any.cc',
+        '../shared/libyuv/source/rotate_argb.cc',
+        '../shared/libyuv/source/rotate_common.cc',
+        '../shared/libyuv/source/rotate.cc',
+        '../shared/libyuv/source/row_any.cc',
+        '../shared/libyuv/source/row_common.cc',
+        '../shared/libyuv/source/scale_any.cc',
+        '../shared/libyuv/source/scale_argb.cc',
+        '../shared/libyuv/source/scale_common.cc',
+        '../shared/libyuv/source/scale.cc',
+        '../shared/libyuv/source/video_common.cc'
+      ],
+      'conditions': [
+        [
+          'OS=="win"',
+          {
+            'defines': [
+              'WIN32',
+              'WIN32_LEAN_AND_MEAN'
+            ],
+            'msvs_settings': {
+              'VCCLCompilerTool': {
+                'AdditionalOptions': [
+                  '/utf-8'
+                ]
+              }
+            },
+            'sources': [
+              '../shared/libyuv/source/compare_win.cc',
+              '../shared/libyuv/source/rotate_win.cc',
+              '../shared/libyuv/source/row_win.cc',
+              '../shared/libyuv/source/scale_win.cc'
+            ]
+          }
+        ],
+        [
+          'OS!="win"',
+          {
+            'sources': [
+              '../shared/libyuv/source/compare_gcc.cc',
+              '../shared/libyuv/source/rotate_gcc.cc',
+              '../shared/libyuv/source/row_gcc.cc',
+              '../shared/libyuv/source/scale_gcc.cc'
+            ]
+          }
+        ]
+      ]
+    }
+  ]
+}
@@ -0,0 +1,234 @@
+#include "fake_rtc_engine.h"
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include "nertc_engine_ex.h"
+#include "nertc_audio_device_manager.h"
+#include "nertc_video_device_manager.h"
+
+using namespace nertc;
+
+namespace nertc_fake
+{
+namespace
+{
+std::atomic<uint64_t> g_seiMessages(0);
+std::atomic<uint64_t> g_seiBytes(0);
+std::atomic<uint64_t> g_liveStreamUpdates(0);
+std::atomic<uint32_t> g_liveStreamUsers(0);
+std::atomic<uint64_t> g_pcmFrames(0);
+std::atomic<uint64_t> g_pcmBytes(0);
+
+class FakeAudioDeviceManager : public IAudioDeviceManager
+{
+public:
+    IDeviceCollection *enumerateRecordDevices() override { return nullptr; }
+    int setRecordDevice(const char device_id[kNERtcMaxDeviceIDLength]) override { return 0; }
+    int getRecordDevice(char device_id[kNERtcMaxDeviceIDLength]) override { device_id[0] = '\0'; return 0; }
+    IDeviceCollection *enumeratePlayoutDevices() override { return nullptr; }
+    int setPlayoutDevice(const char device_id[kNERtcMaxDeviceIDLength]) override { return 0; }
+    int getPlayoutDevice(char device_id[kNERtcMaxDeviceIDLength]) override { device_id[0] = '\0'; return 0; }
+    int setRecordDeviceVolume(uint32_t volume) override { return 0; }
+    int getRecordDeviceVolume(uint32_t *volume) override { *volume = 0; return 0; }
+    int setPlayoutDeviceVolume(uint32_t volume) override { return 0; }
+    int getPlayoutDeviceVolume(uint32_t *volume) override { *volume = 0; return 0; }
+    int setPlayoutDeviceMute(bool mute) override { return 0; }
+    int getPlayoutDeviceMute(bool *mute) override { *mute = false; return 0; }
+    int setRecordDeviceMute(bool mute) override { return 0; }
+    int getRecordDeviceMute(bool *mute) override { *mute = false; return 0; }
+    int adjustRecordingSignalVolume(uint32_t volume) override { return 0; }
+    int adjustPlaybackSignalVolume(uint32_t volume) override { return 0; }
+    int startRecordDeviceTest(uint64_t interval) override { return 0; }
+    int stopRecordDeviceTest() override { return 0; }
+    int startPlayoutDeviceTest(const char *test_audio_file_path) override { return 0; }
+    int stopPlayoutDeviceTest() override { return 0; }
+    int startAudioDeviceLoopbackTest(uint64_t interval) override { return 0; }
+    int stopAudioDeviceLoopbackTest() override { return 0; }
+};
+
+class FakeVideoDeviceManager : public IVideoDeviceManager
+{
+public:
+    IDeviceCollection *enumerateCaptureDevices() override { return nullptr; }
+    int setDevice(const char device_id[kNERtcMaxDeviceIDLength]) override { return 0; }
+    int getDevice(char device_id[kNERtcMaxDeviceIDLength]) override { device_id[0] = '\0'; return 0; }
+};
+
+class FakeRtcEngine : public IRtcEngineEx
+{
+public:
+    FakeRtcEngine() : initialized_(false), pcm_phase_(0) {}
+
+    int initialize(const NERtcEngineContext &context) override { initialized_ = true; return 0; }
+    void release(bool sync) override { initialized_ = false; }
+    int setChannelProfile(NERtcChannelProfileType channel_profile) override { return 0; }
+    int joinChannel(const char *token, const char *channel_name, nertc::uid_t uid) override { return 0; }
+    int leaveChannel() override { return 0; }
+    int queryInterface(NERtcInterfaceIdType iid, void **inter) override
+    {
+        if (!initialized_ || !inter)
+            return -1;
+        if (iid == kNERtcIIDAudioDeviceManager)
+            *inter = static_cast<IAudioDeviceManager *>(&adm_);
+        else if (iid == kNERtcIIDVideoDeviceManager)
+            *inter = static_cast<IVideoDeviceManager *>(&vdm_);
+        else
+            return -1;
+        return 0;
+    }
+    int enableLocalAudio(bool enabled) override { return 0; }
+    int enableLocalVideo(bool enabled) override { return 0; }
+    int subscribeRemoteVideoStream(nertc::uid_t uid, NERtcRemoteVideoStreamType type, bool subscribe) override { return 0; }
+    int setupLocalVideoCanvas(NERtcVideoCanvas *canvas) override { return 0; }
+    int setupRemoteVideoCanvas(nertc::uid_t uid, NERtcVideoCanvas *canvas) override { return 0; }
+    int setClientRole(NERtcClientRole role) override { return 0; }
+
+    NERtcConnectionStateType getConnectionState() override { return kNERtcConnectionStateDisconnected; }
+    int muteLocalAudioStream(bool mute) override { return 0; }
+    int setAudioProfile(NERtcAudioProfileType profile, NERtcAudioScenarioType scenario) override { return 0; }
+    int subscribeRemoteAudioStream(nertc::uid_t uid, bool subscribe) override { return 0; }
+    int setVideoConfig(const NERtcVideoConfig &config) override { return 0; }
+    int enableDualStreamMode(bool enable) override { return 0; }
+    int startVideoPreview() override { return 0; }
+    int stopVideoPreview() override { return 0; }
+    int muteLocalVideoStream(bool mute) override { return 0; }
+    int setParameters(const char *parameters) override { return 0; }
+    int setRecordingAudioFrameParameters(NERtcAudioFrameRequestFormat *format) override { return 0; }
+    int setPlaybackAudioFrameParameters(NERtcAudioFrameRequestFormat *format) override { return 0; }
+    int setMixedAudioFrameParameters(int sample_rate) override { return 0; }
+    int startAudioDump() override { return 0; }
+    int stopAudioDump() override { return 0; }
+    int startAudioMixing(NERtcCreateAudioMixingOption *option) override { return 0; }
+    int stopAudioMixing() override { return 0; }
+    int pauseAudioMixing() override { return 0; }
+    int resumeAudioMixing() override { return 0; }
+    int setAudioMixingSendVolume(uint32_t volume) override { return 0; }
+    int getAudioMixingSendVolume(uint32_t *volume) override { *volume = 0; return 0; }
+    int setAudioMixingPlaybackVolume(uint32_t volume) override { return 0; }
+    int getAudioMixingPlaybackVolume(uint32_t *volume) override { *volume = 0; return 0; }
+    int getAudioMixingDuration(uint64_t *duration) override { *duration = 0; return 0; }
+    int getAudioMixingCurrentPosition(uint64_t *position) override { *position = 0; return 0; }
+    int setAudioMixingPosition(uint64_t pos) override { return 0; }
+    int playEffect(uint32_t effect_id, NERtcCreateAudioEffectOption *option) override { return 0; }
+    int stopEffect(uint32_t effect_id) override { return 0; }
+    int stopAllEffects() override { return 0; }
+    int pauseEffect(uint32_t effect_id) override { return 0; }
+    int resumeEffect(uint32_t effect_id) override { return 0; }
+    int pauseAllEffects() override { return 0; }
+    int resumeAllEffects() override { return 0; }
+    int setEffectSendVolume(uint32_t effect_id, uint32_t volume) override { return 0; }
+    int getEffectSendVolume(uint32_t effect_id, uint32_t *volume) override { *volume = 0; return 0; }
+    int setEffectPlaybackVolume(uint32_t effect_id, uint32_t volume) override { return 0; }
+    int getEffectPlaybackVolume(uint32_t effect_id, uint32_t *volume) override { *volume = 0; return 0; }
+    int enableEarback(bool enabled, uint32_t volume) override { return 0; }
+    int setEarbackVolume(uint32_t volume) override { return 0; }
+    int setStatsObserver(IRtcMediaStatsObserver *observer) override { return 0; }
+    int enableAudioVolumeIndication(bool enable, uint64_t interval) override { return 0; }
+    int startScreenCaptureByScreenRect(const NERtcRectangle &screen_rect, const NERtcRectangle &region_rect, const NERtcScreenCaptureParameters &capture_params) override { return 0; }
+    int startScreenCaptureByDisplayId(int64_t display_id, const NERtcRectangle &region_rect, const NERtcScreenCaptureParameters &capture_params) override { return 0; }
+    int startScreenCaptureByWindowId(void *window_id, const NERtcRectangle &region_rect, const NERtcScreenCaptureParameters &capture_params) override { return 0; }
+    int updateScreenCaptureRegion(const NERtcRectangle &region_rect) override { return 0; }
+    int stopScreenCapture() override { return 0; }
+    int pauseScreenCapture() override { return 0; }
+    int resumeScreenCapture() override { return 0; }
+    int setExternalVideoSource(bool enabled) override { return 0; }
+    const char *getVersion(int32_t *build) override
+    {
+        if (build)
+            *build = 0;
+        return "fake";
+    }
+    const char *getErrorDescription(int error_code) override { return ""; }
+    void uploadSdkInfo() override {}
+    int addLiveStreamTask(const NERtcLiveStreamTaskInfo &info) override { return recordLiveStream(info); }
+    int updateLiveStreamTask(const NERtcLiveStreamTaskInfo &info) override { return recordLiveStream(info); }
+    int removeLiveStreamTask(const char *task_id) override { return 0; }
+    int setupLocalSubStreamVideoCanvas(NERtcVideoCanvas *canvas) override { return 0; }
+    int setupRemoteSubStreamVideoCanvas(nertc::uid_t uid, NERtcVideoCanvas *canvas) override { return 0; }
+    int subscribeRemoteVideoSubStream(nertc::uid_t uid, bool subscribe) override { return 0; }
+    int setExternalAudioSource(bool enabled, int sample_rate, int channels) override { return 0; }
+    int sendSEIMsg(const char *data, int length, NERtcStreamChannelType type) override { return recordSEI(data, length); }
+    int sendSEIMsg(const char *data, int length) override { return recordSEI(data, length); }
+    int setExternalAudioRender(bool enable, int sample_rate, int channels) override { return 0; }
+    int pullExternalAudioFrame(void *data, int len) override;
+    int setAudioEffectPreset(NERtcVoiceChangerType type) override { return 0; }
+    int setVoiceBeautifierPreset(NERtcVoiceBeautifierType type) override { return 0; }
+    int setLocalVoicePitch(double pitch) override { return 0; }
+    int setLocalVoiceEqualization(NERtcVoiceEqualizationBand band_frequency, int band_gain) override { return 0; }
+    int setRemoteHighPriorityAudioStream(bool enabled, nertc::uid_t uid, NERtcAudioStreamType stream_type) override { return 0; }
+    int subscribeRemoteAudioSubStream(nertc::uid_t uid, bool subscribe) override { return 0; }
+    int enableLocalAudioStream(bool enabled, NERtcAudioStreamType stream_type) override { return 0; }
+    int enableLoopbackRecording(bool enabled, const char *device_name) override { return 0; }
+    int adjustLoopbackRecordingSignalVolume(int volume) override { return 0; }
+    int adjustUserPlaybackSignalVolume(nertc::uid_t uid, int volume, NERtcAudioStreamType stream_type) override { return 0; }
+    int checkNECastAudioDriver() override { return 0; }
+
+private:
+    // 与 SDK 一致，长度不合法的 SEI 直接失败
+    int recordSEI(const char *data, int length)
+    {
+        if (!data || length <= 0 || length > kNERtcMacSEIBufferLength)
+            return -1;
+        ++g_seiMessages;
+        g_seiBytes += (uint64_t)length;
+        return 0;
+    }
+
+    int recordLiveStream(const NERtcLiveStreamTaskInfo &info)
+    {
+        if (info.layout.user_count > 0 && !info.layout.users)
+            return -1;
+        ++g_liveStreamUpdates;
+        g_liveStreamUsers = (uint32_t)info.layout.user_count;
+        return 0;
+    }
+
+    FakeAudioDeviceManager adm_;
+    FakeVideoDeviceManager vdm_;
+    bool initialized_;
+    std::mutex pcm_lock_;
+    uint64_t pcm_phase_;
+};
+
+// 48kHz 单声道 16 位的 440Hz 正弦波，连续调用时相位连续
+int FakeRtcEngine::pullExternalAudioFrame(void *data, int len)
+{
+    if (!data || len <= 0)
+        return -1;
+    std::lock_guard<std::mutex> lck(pcm_lock_);
+    const double step = 2 * 3.14159265358979 * 440 / 48000;
+    int16_t *samples = static_cast<int16_t *>(data);
+    size_t count = (size_t)len / sizeof(int16_t);
+    for (size_t i = 0; i < count; i++)
+        samples[i] = (int16_t)(std::sin(step * (double)(pcm_phase_ + i)) * 8000);
+    pcm_phase_ += count;
+    ++g_pcmFrames;
+    g_pcmBytes += (uint64_t)len;
+    return 0;
+}
+} // namespace
+
+FakeRtcEngineCounters getFakeRtcEngineCounters()
+{
+    FakeRtcEngineCounters counters;
+    counters.sei_messages = g_seiMessages;
+    counters.sei_bytes = g_seiBytes;
+    counters.live_stream_updates = g_liveStreamUpdates;
+    counters.live_stream_users = g_liveStreamUsers;
+    counters.pcm_frames = g_pcmFrames;
+    counters.pcm_bytes = g_pcmBytes;
+    return counters;
+}
+
+} // namespace nertc_fake
+
+extern "C" void *createNERtcEngine()
+{
+    return static_cast<nertc::IRtcEngineEx *>(new nertc_fake::FakeRtcEngine());
+}
+
+extern "C" void destroyNERtcEngine(void *&nertc_engine_inst)
+{
+    delete static_cast<nertc::IRtcEngineEx *>(nertc_engine_inst);
+    nertc_engine_inst = nullptr;
+}
@@ -0,0 +1,25 @@
+#ifndef NERTC_FAKE_RTC_ENGINE_H
+#define NERTC_FAKE_RTC_ENGINE_H
+
+#include <stdint.h>
+
+// createNERtcEngine 返回的假引擎：主动调用一律成功且不产生回调，只记录发往 SDK 的调用，
+// 用于在没有 SDK 库时测试 SEI 发送、直播布局更新、外部音频拉取等主动调用路径
+namespace nertc_fake
+{
+    struct FakeRtcEngineCounters
+    {
+        uint64_t sei_messages;         // sendSEIMsg 调用次数（两个重载合计）
+        uint64_t sei_bytes;
+        uint64_t live_stream_updates;  // addLiveStreamTask 与 updateLiveStreamTask 调用次数
+        uint32_t live_stream_users;    // 最近一次提交的 layout.user_count
+        uint64_t pcm_frames;           // pullExternalAudioFrame 调用次数
+        uint64_t pcm_bytes;
+    };
+
+    // 所有假引擎实例累计的计数
+    FakeRtcEngineCounters getFakeRtcEngineCounters();
+
+} // namespace nertc_fake
+
+#endif //NERTC_FAKE_RTC_ENGINE_H
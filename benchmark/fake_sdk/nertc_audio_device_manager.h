@@ -0,0 +1,38 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_engine_defines.h"
+namespace nertc {
+class IDeviceCollection {
+public:
+    virtual ~IDeviceCollection() {}
+    virtual uint16_t getCount() = 0;
+    virtual int getDeviceInfo(uint16_t index, NERtcDeviceInfo *device_info) = 0;
+    virtual void destroy() = 0;
+};
+class IAudioDeviceManager {
+public:
+    virtual ~IAudioDeviceManager() {}
+    virtual IDeviceCollection *enumerateRecordDevices() = 0;
+    virtual int setRecordDevice(const char device_id[kNERtcMaxDeviceIDLength]) = 0;
+    virtual int getRecordDevice(char device_id[kNERtcMaxDeviceIDLength]) = 0;
+    virtual IDeviceCollection *enumeratePlayoutDevices() = 0;
+    virtual int setPlayoutDevice(const char device_id[kNERtcMaxDeviceIDLength]) = 0;
+    virtual int getPlayoutDevice(char device_id[kNERtcMaxDeviceIDLength]) = 0;
+    virtual int setRecordDeviceVolume(uint32_t volume) = 0;
+    virtual int getRecordDeviceVolume(uint32_t *volume) = 0;
+    virtual int setPlayoutDeviceVolume(uint32_t volume) = 0;
+    virtual int getPlayoutDeviceVolume(uint32_t *volume) = 0;
+    virtual int setPlayoutDeviceMute(bool mute) = 0;
+    virtual int getPlayoutDeviceMute(bool *mute) = 0;
+    virtual int setRecordDeviceMute(bool mute) = 0;
+    virtual int getRecordDeviceMute(bool *mute) = 0;
+    virtual int adjustRecordingSignalVolume(uint32_t volume) = 0;
+    virtual int adjustPlaybackSignalVolume(uint32_t volume) = 0;
+    virtual int startRecordDeviceTest(uint64_t interval) = 0;
+    virtual int stopRecordDeviceTest() = 0;
+    virtual int startPlayoutDeviceTest(const char *test_audio_file_path) = 0;
+    virtual int stopPlayoutDeviceTest() = 0;
+    virtual int startAudioDeviceLoopbackTest(uint64_t interval) = 0;
+    virtual int stopAudioDeviceLoopbackTest() = 0;
+};
+}
@@ -0,0 +1,25 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_engine_defines.h"
+#include "nertc_engine_event_handler_ex.h"
+#include "nertc_engine_media_stats_observer.h"
+namespace nertc {
+class IRtcEngine {
+public:
+    virtual ~IRtcEngine() {}
+    virtual int initialize(const NERtcEngineContext& context) = 0;
+    virtual void release(bool sync = true) = 0;
+    virtual int setChannelProfile(NERtcChannelProfileType channel_profile) = 0;
+    virtual int joinChannel(const char* token, const char* channel_name, uid_t uid) = 0;
+    virtual int leaveChannel() = 0;
+    virtual int queryInterface(NERtcInterfaceIdType iid, void** inter) = 0;
+    virtual int enableLocalAudio(bool enabled) = 0;
+    virtual int enableLocalVideo(bool enabled) = 0;
+    virtual int subscribeRemoteVideoStream(uid_t uid, NERtcRemoteVideoStreamType type, bool subscribe) = 0;
+    virtual int setupLocalVideoCanvas(NERtcVideoCanvas* canvas) = 0;
+    virtual int setupRemoteVideoCanvas(uid_t uid, NERtcVideoCanvas* canvas) = 0;
+    virtual int setClientRole(NERtcClientRole role) = 0;
+};
+}
+extern "C" void* createNERtcEngine();
+extern "C" void destroyNERtcEngine(void*& nertc_engine_inst);
@@ -0,0 +1,106 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#define kNERtcMaxPlaneCount 4
+#define kNERtcMaxDeviceIDLength 256
+#define kNERtcMaxDeviceNameLength 256
+#define kNERtcMaxURILength 256
+#define kNERtcMaxTaskIDLength 64
+#define kNERtcMacSEIBufferLength 4096
+namespace nertc {
+typedef uint64_t uid_t;
+typedef uint64_t channel_id_t;
+class IRtcEngineEventHandlerEx;
+enum NERtcErrorCode { kNERtcNoError = 0 };
+enum NERtcLogLevel { kNERtcLogLevelInfo = 3 };
+enum NERtcVideoProfileType { kNERtcVideoProfileLowest = 0 };
+enum NERtcClientRole { kNERtcClientRoleBroadcaster = 0 };
+enum NERtcAudioDeviceType { kNERtcAudioDeviceUnknown = 0 };
+enum NERtcAudioDeviceState { kNERtcAudioDeviceActive = 0 };
+enum NERtcVideoDeviceType { kNERtcVideoDeviceUnknown = 0 };
+enum NERtcVideoDeviceState { kNERtcVideoDeviceStateAdded = 0 };
+enum NERtcVideoType { kNERtcVideoTypeI420 = 0 };
+enum NERtcVideoRotation { kNERtcVideoRotation_0 = 0, kNERtcVideoRotation_90 = 90, kNERtcVideoRotation_180 = 180, kNERtcVideoRotation_270 = 270 };
+enum NERtcSessionLeaveReason { kNERtcSessionLeaveNormal = 0 };
+enum NERtcConnectionStateType { kNERtcConnectionStateDisconnected = 1 };
+enum NERtcReasonConnectionChangedType { kNERtcReasonConnectionChangedLeaveChannel = 0 };
+enum NERtcLiveStreamStateCode { kNERtcLsStatePushing = 505 };
+enum NERtcInstallCastAudioDriverResult { kNERtcInstallCastAudioDriverSuccess = 0 };
+enum NERtcAudioMixingState { kNERtcAudioMixingStateFinished = 0, kNERtcAudioMixingStateFailed };
+enum NERtcAudioMixingErrorCode { kNERtcAudioMixingErrorOK = 0, kNERtcAudioMixingErrorCanNotOpen };
+enum NERtcAudioStreamType { kNERtcAudioStreamTypeMain = 0 };
+enum NERtcVideoFramerateType { kNERtcVideoFramerateFps_15 = 15 };
+enum NERtcVideoCropMode { kNERtcVideoCropModeDefault = 0 };
+enum NERtcDegradationPreference { kNERtcDegradationDefault = 0 };
+enum NERtcVoiceEqualizationBand { kNERtcVoiceEqualizationBand_31 = 0 };
+enum NERtcVoiceChangerType { kNERtcVoiceChangerOff = 0 };
+enum NERtcVoiceBeautifierType { kNERtcVoiceBeautifierOff = 0 };
+enum NERtcSubStreamContentPrefer { kNERtcSubStreamContentPreferMotion = 0 };
+enum NERtcStreamChannelType { kNERtcStreamChannelTypeMainStream = 0, kNERtcStreamChannelTypeSubStream = 1 };
+enum NERtcScreenProfileType { kNERtcScreenProfile480P = 0 };
+enum NERtcRemoteVideoStreamType { kNERtcRemoteVideoStreamTypeHigh = 0 };
+enum NERtcLiveStreamVideoScaleMode { kNERtcLsModeVideoScaleFit = 0 };
+enum NERtcLiveStreamMode { kNERtcLsModeVideo = 0 };
+enum NERtcLiveStreamAudioSampleRate { kNERtcLiveStreamAudioSampleRate48000 = 48000 };
+enum NERtcLiveStreamAudioCodecProfile { kNERtcLiveStreamAudioCodecProfileLCAAC = 0 };
+enum NERtcChannelProfileType { kNERtcChannelProfileCommunication = 0 };
+enum NERtcAudioScenarioType { kNERtcAudioScenarioDefault = 0 };
+enum NERtcAudioProfileType { kNERtcAudioProfileDefault = 0 };
+enum NERtcNetworkQualityType { kNERtcNetworkQualityUnknown = 0 };
+enum NERtcVideoScalingMode { kNERtcVideoScaleFit = 0 };
+enum NERtcInterfaceIdType { kNERtcIIDAudioDeviceManager = 1, kNERtcIIDVideoDeviceManager = 2 };
+enum NERtcVideoStreamType { kNERtcVideoStreamTypeMain = 0 };
+
+struct NERtcEngineContext {
+    const char *app_key = nullptr;
+    IRtcEngineEventHandlerEx *event_handler = nullptr;
+    const char *log_dir_path = nullptr;
+    NERtcLogLevel log_level = kNERtcLogLevelInfo;
+    uint32_t log_file_max_size_KBytes = 0;
+    bool video_use_exnternal_render = true;
+    bool video_prefer_hw_decoder = false;
+    bool video_prefer_hw_encoder = false;
+};
+struct NERtcVideoConfig {
+    NERtcVideoProfileType max_profile; uint32_t width; uint32_t height; NERtcVideoCropMode crop_mode_;
+    NERtcVideoFramerateType framerate; NERtcVideoFramerateType min_framerate; uint32_t bitrate; uint32_t min_bitrate;
+    NERtcDegradationPreference degradation_preference;
+};
+struct NERtcAudioFrameRequestFormat { uint32_t channels; uint32_t sample_rate; };
+struct NERtcCreateAudioMixingOption { char path[kNERtcMaxURILength]; int loop_count; bool send_enabled; uint32_t send_volume; bool playback_enabled; uint32_t playback_volume; };
+struct NERtcCreateAudioEffectOption { char path[kNERtcMaxURILength]; int loop_count; bool send_enabled; uint32_t send_volume; bool playback_enabled; uint32_t playback_volume; };
+struct NERtcRectangle { int x; int y; int width; int height; };
+struct NERtcVideoDimensions { int width; int height; };
+struct NERtcScreenCaptureParameters {
+    NERtcScreenProfileType profile; NERtcVideoDimensions dimensions; int frame_rate; int bitrate;
+    bool capture_mouse_cursor; bool window_focus; void *excluded_window_list; int excluded_window_count;
+    NERtcSubStreamContentPrefer prefer;
+};
+struct NERtcLiveStreamImageInfo { char url[kNERtcMaxURILength]; int x; int y; int width; int height; };
+struct NERtcLiveStreamUserTranscoding { uid_t uid; bool video_push; NERtcLiveStreamVideoScaleMode adaption; int x; int y; int width; int height; bool audio_push; int z_order; };
+struct NERtcLiveStreamLayout { int width; int height; uint32_t background_color; NERtcLiveStreamUserTranscoding *users; int user_count; NERtcLiveStreamImageInfo *bg_image; };
+struct NERtcLiveConfig { bool single_video_passthrough; int audio_bitrate; NERtcLiveStreamAudioSampleRate sampleRate; int channels; NERtcLiveStreamAudioCodecProfile audioCodecProfile; };
+struct NERtcLiveStreamTaskInfo {
+    char task_id[kNERtcMaxTaskIDLength]; char stream_url[kNERtcMaxURILength]; bool server_record_enabled;
+    NERtcLiveStreamMode ls_mode; NERtcLiveStreamLayout layout; NERtcLiveConfig config; char extraInfo[kNERtcMacSEIBufferLength];
+};
+struct NERtcStats {
+    uint32_t cpu_app_usage, cpu_idle_usage, cpu_total_usage, memory_app_usage, memory_total_usage, memory_app_kbytes;
+    int total_duration; uint64_t tx_bytes, rx_bytes, tx_audio_bytes, tx_video_bytes, rx_audio_bytes, rx_video_bytes;
+    int tx_audio_kbitrate, rx_audio_kbitrate, tx_video_kbitrate, rx_video_kbitrate, up_rtt, down_rtt;
+    int tx_audio_packet_loss_rate, tx_video_packet_loss_rate, tx_audio_packet_loss_sum, tx_video_packet_loss_sum, tx_audio_jitter, tx_video_jitter;
+    int rx_audio_packet_loss_rate, rx_video_packet_loss_rate, rx_audio_packet_loss_sum, rx_video_packet_loss_sum, rx_audio_jitter, rx_video_jitter;
+};
+struct NERtcAudioSendStats { int num_channels; int sent_sample_rate; int sent_bitrate; int audio_loss_rate; int64_t rtt; unsigned int volume; };
+struct NERtcAudioRecvStats { uid_t uid; int received_bitrate; int total_frozen_time; int frozen_rate; int audio_loss_rate; unsigned int volume; };
+struct NERtcVideoLayerSendStats { int layer_type; int width; int height; int capture_frame_rate; int render_frame_rate; int encoder_frame_rate; int sent_frame_rate; int sent_bitrate; int target_bitrate; int encoder_bitrate; char codec_name[16]; };
+struct NERtcVideoSendStats { NERtcVideoLayerSendStats *video_layers_list; int video_layers_count; };
+struct NERtcVideoLayerRecvStats { int layer_type; int width; int height; int received_bitrate; int received_frame_rate; int decoder_frame_rate; int render_frame_rate; int packet_loss_rate; int total_frozen_time; int frozen_rate; char codec_name[16]; };
+struct NERtcVideoRecvStats { uid_t uid; NERtcVideoLayerRecvStats *video_layers_list; int video_layers_count; };
+struct NERtcNetworkQualityInfo { uid_t uid; NERtcNetworkQualityType tx_quality; NERtcNetworkQualityType rx_quality; };
+struct NERtcAudioVolumeInfo { uid_t uid; unsigned int volume; };
+typedef void (*onFrameDataCallback)(uid_t uid, void *data, uint32_t type, uint32_t width, uint32_t height, uint32_t count, uint32_t offset[kNERtcMaxPlaneCount], uint32_t stride[kNERtcMaxPlaneCount], uint32_t rotation, void *user_data);
+struct NERtcVideoCanvas { onFrameDataCallback cb; void *user_data; void *window; NERtcVideoScalingMode scaling_mode; };
+struct NERtcDeviceInfo { char device_id[kNERtcMaxDeviceIDLength]; char device_name[kNERtcMaxDeviceNameLength]; int transport_type; bool suspected_unavailable; bool system_default_device; };
+}
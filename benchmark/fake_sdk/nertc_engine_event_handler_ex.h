@@ -0,0 +1,53 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_engine_defines.h"
+namespace nertc {
+class IRtcEngineEventHandler {
+public:
+    virtual ~IRtcEngineEventHandler() {}
+    virtual void onError(int error_code, const char* msg) {}
+    virtual void onWarning(int warn_code, const char* msg) {}
+    virtual void onReleasedHwResources(NERtcErrorCode result) {}
+    virtual void onJoinChannel(channel_id_t cid, uid_t uid, NERtcErrorCode result, uint64_t elapsed) {}
+    virtual void onConnectionStateChange(NERtcConnectionStateType state, NERtcReasonConnectionChangedType reason) {}
+    virtual void onReconnectingStart(channel_id_t cid, uid_t uid) {}
+    virtual void onRejoinChannel(channel_id_t cid, uid_t uid, NERtcErrorCode result, uint64_t elapsed) {}
+    virtual void onLeaveChannel(NERtcErrorCode result) {}
+    virtual void onDisconnect(NERtcErrorCode reason) {}
+    virtual void onClientRoleChanged(NERtcClientRole oldRole, NERtcClientRole newRole) {}
+    virtual void onUserJoined(uid_t uid, const char * user_name) {}
+    virtual void onUserLeft(uid_t uid, NERtcSessionLeaveReason reason) {}
+    virtual void onUserAudioStart(uid_t uid) {}
+    virtual void onUserAudioStop(uid_t uid) {}
+    virtual void onUserVideoStart(uid_t uid, NERtcVideoProfileType max_profile) {}
+    virtual void onUserVideoStop(uid_t uid) {}
+};
+class IRtcEngineEventHandlerEx : public IRtcEngineEventHandler {
+public:
+    virtual void onUserSubStreamVideoStart(uid_t uid, NERtcVideoProfileType max_profile) {}
+    virtual void onUserSubStreamVideoStop(uid_t uid) {}
+    virtual void onUserVideoProfileUpdate(uid_t uid, NERtcVideoProfileType max_profile) {}
+    virtual void onUserAudioMute(uid_t uid, bool mute) {}
+    virtual void onUserVideoMute(uid_t uid, bool mute) {}
+    virtual void onAudioDeviceStateChanged(const char device_id[kNERtcMaxDeviceIDLength], NERtcAudioDeviceType device_type, NERtcAudioDeviceState device_state) {}
+    virtual void onAudioDefaultDeviceChanged(const char device_id[kNERtcMaxDeviceIDLength], NERtcAudioDeviceType device_type) {}
+    virtual void onVideoDeviceStateChanged(const char device_id[kNERtcMaxDeviceIDLength], NERtcVideoDeviceType device_type, NERtcVideoDeviceState device_state) {}
+    virtual void onFirstAudioDataReceived(uid_t uid) {}
+    virtual void onFirstVideoDataReceived(uid_t uid) {}
+    virtual void onFirstAudioFrameDecoded(uid_t uid) {}
+    virtual void onFirstVideoFrameDecoded(uid_t uid, uint32_t width, uint32_t height) {}
+    virtual void onCaptureVideoFrame(void *data, NERtcVideoType type, uint32_t width, uint32_t height, uint32_t count, uint32_t offset[kNERtcMaxPlaneCount], uint32_t stride[kNERtcMaxPlaneCount], NERtcVideoRotation rotation) {}
+    virtual void onAudioMixingStateChanged(NERtcAudioMixingState state, NERtcAudioMixingErrorCode error_code) {}
+    virtual void onAudioMixingTimestampUpdate(uint64_t timestamp_ms) {}
+    virtual void onAudioEffectFinished(uint32_t effect_id) {}
+    virtual void onLocalAudioVolumeIndication(int volume) {}
+    virtual void onRemoteAudioVolumeIndication(const NERtcAudioVolumeInfo *speakers, unsigned int speaker_number, int total_volume) {}
+    virtual void onAddLiveStreamTask(const char* task_id, const char* url, int error_code) {}
+    virtual void onUpdateLiveStreamTask(const char* task_id, const char* url, int error_code) {}
+    virtual void onRemoveLiveStreamTask(const char* task_id, int error_code) {}
+    virtual void onLiveStreamState(const char* task_id, const char* url, NERtcLiveStreamStateCode state) {}
+    virtual void onAudioHowling(bool howling) {}
+    virtual void onRecvSEIMsg(uid_t uid, const char* data, uint32_t dataSize) {}
+    virtual void onCheckNECastAudioDriverResult(NERtcInstallCastAudioDriverResult result) {}
+};
+}
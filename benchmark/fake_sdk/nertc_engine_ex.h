@@ -0,0 +1,82 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_engine.h"
+namespace nertc {
+class IRtcEngineEx : public IRtcEngine {
+public:
+    virtual NERtcConnectionStateType getConnectionState() = 0;
+    virtual int muteLocalAudioStream(bool mute) = 0;
+    virtual int setAudioProfile(NERtcAudioProfileType profile, NERtcAudioScenarioType scenario) = 0;
+    virtual int subscribeRemoteAudioStream(uid_t uid, bool subscribe) = 0;
+    virtual int setVideoConfig(const NERtcVideoConfig& config) = 0;
+    virtual int enableDualStreamMode(bool enable) = 0;
+    virtual int startVideoPreview() = 0;
+    virtual int stopVideoPreview() = 0;
+    virtual int muteLocalVideoStream(bool mute) = 0;
+    virtual int setParameters(const char* parameters) = 0;
+    virtual int setRecordingAudioFrameParameters(NERtcAudioFrameRequestFormat *format) = 0;
+    virtual int setPlaybackAudioFrameParameters(NERtcAudioFrameRequestFormat *format) = 0;
+    virtual int setMixedAudioFrameParameters(int sample_rate) = 0;
+    virtual int startAudioDump() = 0;
+    virtual int stopAudioDump() = 0;
+    virtual int startAudioMixing(NERtcCreateAudioMixingOption *option) = 0;
+    virtual int stopAudioMixing() = 0;
+    virtual int pauseAudioMixing() = 0;
+    virtual int resumeAudioMixing() = 0;
+    virtual int setAudioMixingSendVolume(uint32_t volume) = 0;
+    virtual int getAudioMixingSendVolume(uint32_t *volume) = 0;
+    virtual int setAudioMixingPlaybackVolume(uint32_t volume) = 0;
+    virtual int getAudioMixingPlaybackVolume(uint32_t *volume) = 0;
+    virtual int getAudioMixingDuration(uint64_t *duration) = 0;
+    virtual int getAudioMixingCurrentPosition(uint64_t *position) = 0;
+    virtual int setAudioMixingPosition(uint64_t pos) = 0;
+    virtual int playEffect(uint32_t effect_id, NERtcCreateAudioEffectOption *option) = 0;
+    virtual int stopEffect(uint32_t effect_id) = 0;
+    virtual int stopAllEffects() = 0;
+    virtual int pauseEffect(uint32_t effect_id) = 0;
+    virtual int resumeEffect(uint32_t effect_id) = 0;
+    virtual int pauseAllEffects() = 0;
+    virtual int resumeAllEffects() = 0;
+    virtual int setEffectSendVolume(uint32_t effect_id, uint32_t volume) = 0;
+    virtual int getEffectSendVolume(uint32_t effect_id, uint32_t *volume) = 0;
+    virtual int setEffectPlaybackVolume(uint32_t effect_id, uint32_t volume) = 0;
+    virtual int getEffectPlaybackVolume(uint32_t effect_id, uint32_t *volume) = 0;
+    virtual int enableEarback(bool enabled, uint32_t volume) = 0;
+    virtual int setEarbackVolume(uint32_t volume) = 0;
+    virtual int setStatsObserver(IRtcMediaStatsObserver *observer) = 0;
+    virtual int enableAudioVolumeIndication(bool enable, uint64_t interval) = 0;
+    virtual int startScreenCaptureByScreenRect(const NERtcRectangle& screen_rect, const NERtcRectangle& region_rect, const NERtcScreenCaptureParameters& capture_params) = 0;
+    virtual int startScreenCaptureByDisplayId(int64_t display_id, const NERtcRectangle& region_rect, const NERtcScreenCaptureParameters& capture_params) = 0;
+    virtual int startScreenCaptureByWindowId(void* window_id, const NERtcRectangle& region_rect, const NERtcScreenCaptureParameters& capture_params) = 0;
+    virtual int updateScreenCaptureRegion(const NERtcRectangle& region_rect) = 0;
+    virtual int stopScreenCapture() = 0;
+    virtual int pauseScreenCapture() = 0;
+    virtual int resumeScreenCapture() = 0;
+    virtual int setExternalVideoSource(bool enabled) = 0;
+    virtual const char* getVersion(int32_t* build) = 0;
+    virtual const char* getErrorDescription(int error_code) = 0;
+    virtual void uploadSdkInfo() = 0;
+    virtual int addLiveStreamTask(const NERtcLiveStreamTaskInfo& info) = 0;
+    virtual int updateLiveStreamTask(const NERtcLiveStreamTaskInfo& info) = 0;
+    virtual int removeLiveStreamTask(const char* task_id) = 0;
+    virtual int setupLocalSubStreamVideoCanvas(NERtcVideoCanvas* canvas) = 0;
+    virtual int setupRemoteSubStreamVideoCanvas(uid_t uid, NERtcVideoCanvas* canvas) = 0;
+    virtual int subscribeRemoteVideoSubStream(uid_t uid, bool subscribe) = 0;
+    virtual int setExternalAudioSource(bool enabled, int sample_rate, int channels) = 0;
+    virtual int sendSEIMsg(const char* data, int length, NERtcStreamChannelType type) = 0;
+    virtual int sendSEIMsg(const char* data, int length) = 0;
+    virtual int setExternalAudioRender(bool enable, int sample_rate, int channels) = 0;
+    virtual int pullExternalAudioFrame(void* data, int len) = 0;
+    virtual int setAudioEffectPreset(NERtcVoiceChangerType type) = 0;
+    virtual int setVoiceBeautifierPreset(NERtcVoiceBeautifierType type) = 0;
+    virtual int setLocalVoicePitch(double pitch) = 0;
+    virtual int setLocalVoiceEqualization(NERtcVoiceEqualizationBand band_frequency, int band_gain) = 0;
+    virtual int setRemoteHighPriorityAudioStream(bool enabled, uid_t uid, NERtcAudioStreamType stream_type) = 0;
+    virtual int subscribeRemoteAudioSubStream(uid_t uid, bool subscribe) = 0;
+    virtual int enableLocalAudioStream(bool enabled, NERtcAudioStreamType stream_type) = 0;
+    virtual int enableLoopbackRecording(bool enabled, const char* device_name) = 0;
+    virtual int adjustLoopbackRecordingSignalVolume(int volume) = 0;
+    virtual int adjustUserPlaybackSignalVolume(uid_t uid, int volume, NERtcAudioStreamType stream_type) = 0;
+    virtual int checkNECastAudioDriver() = 0;
+};
+}
@@ -0,0 +1,15 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_engine_defines.h"
+namespace nertc {
+class IRtcMediaStatsObserver {
+public:
+    virtual ~IRtcMediaStatsObserver() {}
+    virtual void onRtcStats(const NERtcStats &stats) {}
+    virtual void onLocalAudioStats(const NERtcAudioSendStats &stats) {}
+    virtual void onRemoteAudioStats(const NERtcAudioRecvStats *stats, unsigned int user_count) {}
+    virtual void onLocalVideoStats(const NERtcVideoSendStats &stats) {}
+    virtual void onRemoteVideoStats(const NERtcVideoRecvStats *stats, unsigned int user_count) {}
+    virtual void onNetworkQuality(const NERtcNetworkQualityInfo *infos, unsigned int user_count) {}
+};
+}
@@ -0,0 +1,12 @@
+// 离线构建用的 SDK 头文件子集，只声明绑定层用到的类型与接口，实现见 fake_rtc_engine.cpp
+#pragma once
+#include "nertc_audio_device_manager.h"
+namespace nertc {
+class IVideoDeviceManager {
+public:
+    virtual ~IVideoDeviceManager() {}
+    virtual IDeviceCollection *enumerateCaptureDevices() = 0;
+    virtual int setDevice(const char device_id[kNERtcMaxDeviceIDLength]) = 0;
+    virtual int getDevice(char device_id[kNERtcMaxDeviceIDLength]) = 0;
+};
+}
@@ -0,0 +1,288 @@
+// 统计对象封装耗时对比：同一组转换函数分别在关闭/开启属性名缓存、按模板创建对象时运行，
+// NERtcStats 完整转换与按需取值对象的对比，JS 字符串参数与直播推流任务的转换耗时，输出平均纳秒数。构建与运行方式见 benchmark/README.md
+#include <chrono>
+#include "../nertc_sdk_node/nertc_node_engine_helper.h"
+#include "../nertc_sdk_node/nertc_node_stats_template.h"
+#include "../shared/sdk_helper/nim_node_helper.h"
+
+using namespace nertc_node;
+
+static const int kVideoLayerCount = 2;
+
+template <typename Fn>
+static double measure(Isolate* isolate, uint32_t iterations, NodeStatsShape shape, bool useTemplate, Fn fn)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        HandleScope scope(isolate);
+        Local<Object> obj = useTemplate ? nertc_new_stats_obj(isolate, shape) : Object::New(isolate);
+        fn(obj);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+template <typename Fn>
+static void compare(Isolate* isolate, Local<Object>& result, const char* name, NodeStatsShape shape, uint32_t iterations, Fn fn)
+{
+    nim_node::key_cache* cache = nim_node::key_cache::get_instance(isolate);
+    // 先各跑一轮预热，排除首次创建字符串与 JIT 的影响
+    cache->set_enabled(false);
+    measure(isolate, iterations / 10 + 1, shape, false, fn);
+    double uncached = measure(isolate, iterations, shape, false, fn);
+    cache->set_enabled(true);
+    measure(isolate, iterations / 10 + 1, shape, false, fn);
+    double cached = measure(isolate, iterations, shape, false, fn);
+    measure(isolate, iterations / 10 + 1, shape, true, fn);
+    double templated = measure(isolate, iterations, shape, true, fn);
+
+    Local<Object> item = Object::New(isolate);
+    nim_napi_set_object_value_double(isolate, item, "uncached_ns", uncached);
+    nim_napi_set_object_value_double(isolate, item, "cached_ns", cached);
+    nim_napi_set_object_value_double(isolate, item, "template_ns", templated);
+    result->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, name), item);
+}
+
+static void Run(const FunctionCallbackInfo<Value>& args)
+{
+    Isolate* isolate = args.GetIsolate();
+    uint32_t iterations = 100000;
+    if (args.Length() > 0)
+        nim_napi_get_value_uint32(isolate, args[0], iterations);
+    if (iterations == 0)
+        iterations = 1;
+
+    nertc::NERtcStats stats = {};
+    nertc::NERtcVideoLayerRecvStats layers[kVideoLayerCount] = {};
+    nertc::NERtcVideoRecvStats videoRecv = {};
+    videoRecv.video_layers_list = layers;
+    videoRecv.video_layers_count = kVideoLayerCount;
+    nertc::NERtcAudioVolumeInfo volume = {};
+
+    Local<Object> result = Object::New(isolate);
+    compare(isolate, result, "stats", NODE_STATS_SHAPE_RTC, iterations, [&](Local<Object>& obj) {
+        nertc_stats_to_obj(isolate, stats, obj);
+    });
+    compare(isolate, result, "video_recv_stats", NODE_STATS_SHAPE_VIDEO_RECV, iterations, [&](Local<Object>& obj) {
+        nertc_video_recv_stats_to_obj(isolate, videoRecv, obj);
+    });
+    compare(isolate, result, "audio_volume_info", NODE_STATS_SHAPE_AUDIO_VOLUME, iterations, [&](Local<Object>& obj) {
+        nertc_audio_volume_info_to_obj(isolate, volume, obj);
+    });
+    args.GetReturnValue().Set(result);
+}
+
+// 回调里常用的几个字段
+static const char* const kLazyReadKeys[] = { "cpu_app_usage", "rx_bytes", "tx_bytes", "rx_audio_packet_loss_rate" };
+
+static double measureLazy(Isolate* isolate, uint32_t iterations, const nertc::NERtcStats& stats, bool lazy, uint32_t readCount)
+{
+    Local<Context> context = isolate->GetCurrentContext();
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        HandleScope scope(isolate);
+        Local<Object> obj;
+        if (lazy)
+        {
+            obj = nertc_new_lazy_stats_obj(isolate, stats);
+        }
+        else
+        {
+            obj = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_RTC);
+            nertc_stats_to_obj(isolate, stats, obj);
+        }
+        if (readCount == UINT32_MAX)
+        {
+            Local<Array> names = obj->GetOwnPropertyNames(context).ToLocalChecked();
+            for (uint32_t j = 0; j < names->Length(); j++)
+                obj->Get(context, names->Get(context, j).ToLocalChecked()).ToLocalChecked();
+        }
+        else
+        {
+            for (uint32_t j = 0; j < readCount; j++)
+                obj->Get(context, nim_napi_new_key(isolate, kLazyReadKeys[j])).ToLocalChecked();
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+// NERtcStats 完整转换（eager）与按需取值（lazy）在读取 0、4 个及全部字段时的耗时，
+// 计时包含弱句柄登记，但不包含对象回收时释放快照的开销
+static void RunLazy(const FunctionCallbackInfo<Value>& args)
+{
+    Isolate* isolate = args.GetIsolate();
+    uint32_t iterations = 100000;
+    if (args.Length() > 0)
+        nim_napi_get_value_uint32(isolate, args[0], iterations);
+    if (iterations == 0)
+        iterations = 1;
+
+    nertc::NERtcStats stats = {};
+    const uint32_t kReadAll = UINT32_MAX;
+    const uint32_t readCounts[] = { 0, sizeof(kLazyReadKeys) / sizeof(kLazyReadKeys[0]), kReadAll };
+    const char* const names[] = { "read_none", "read_4", "read_all" };
+
+    Local<Object> result = Object::New(isolate);
+    for (size_t i = 0; i < sizeof(readCounts) / sizeof(readCounts[0]); i++)
+    {
+        measureLazy(isolate, iterations / 10 + 1, stats, false, readCounts[i]);
+        double eager = measureLazy(isolate, iterations, stats, false, readCounts[i]);
+        measureLazy(isolate, iterations / 10 + 1, stats, true, readCounts[i]);
+        double lazy = measureLazy(isolate, iterations, stats, true, readCounts[i]);
+
+        Local<Object> item = Object::New(isolate);
+        nim_napi_set_object_value_double(isolate, item, "eager_ns", eager);
+        nim_napi_set_object_value_double(isolate, item, "lazy_ns", lazy);
+        result->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, names[i]), item);
+    }
+    args.GetReturnValue().Set(result);
+}
+
+// 改为内部存储与缓冲池之前的转换方式：calloc 临时缓冲区写入 UTF-8，再由 set 分配并拷贝一次
+static void legacyGetUtf8String(Isolate* isolate, const Local<Value>& value, std::string& out)
+{
+    int len = value.As<String>()->Utf8Length(isolate);
+    if (len == 0)
+        return;
+    utf8_char* str = (utf8_char*)calloc(len + 1, 1);
+    len = value.As<String>()->WriteUtf8(isolate, str, len, nullptr, String::REPLACE_INVALID_UTF8 | String::NO_NULL_TERMINATION);
+    str[len] = '\0';
+    utf8_char* mem = (utf8_char*)calloc(len + 1, sizeof(utf8_char));
+    strcpy(mem, str);
+    free(str);
+    out.assign(mem);
+    free(mem);
+}
+
+template <typename Fn>
+static double measureLoop(uint32_t iterations, Fn fn)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+        fn();
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+// 对 runString 传入的每个 { name: string } 分别用旧方式与 nim_napi_get_value_utf8string 转换，
+// 先校验两者结果一致，计时不含结果的使用
+static void RunString(const FunctionCallbackInfo<Value>& args)
+{
+    Isolate* isolate = args.GetIsolate();
+    Local<Context> context = isolate->GetCurrentContext();
+    if (args.Length() < 1 || !args[0]->IsObject())
+        return;
+    uint32_t iterations = 100000;
+    if (args.Length() > 1)
+        nim_napi_get_value_uint32(isolate, args[1], iterations);
+    if (iterations == 0)
+        iterations = 1;
+
+    Local<Object> cases = args[0].As<Object>();
+    Local<Array> names = cases->GetOwnPropertyNames(context).ToLocalChecked();
+    Local<Object> result = Object::New(isolate);
+    for (uint32_t i = 0; i < names->Length(); i++)
+    {
+        Local<Value> name = names->Get(context, i).ToLocalChecked();
+        Local<Value> value = cases->Get(context, name).ToLocalChecked();
+        if (!value->IsString())
+            continue;
+        std::string expected;
+        legacyGetUtf8String(isolate, value, expected);
+        UTF8String converted;
+        nim_napi_get_value_utf8string(isolate, value, converted);
+        if (converted.toUtf8String() != expected)
+        {
+            isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, "conversion mismatch").ToLocalChecked()));
+            return;
+        }
+
+        std::string legacyOut;
+        double legacy = measureLoop(iterations, [&]() { legacyGetUtf8String(isolate, value, legacyOut); });
+        double current = measureLoop(iterations, [&]() {
+            UTF8String out;
+            nim_napi_get_value_utf8string(isolate, value, out);
+        });
+        Local<Object> item = Object::New(isolate);
+        nim_napi_set_object_value_uint32(isolate, item, "bytes", (uint32_t)expected.size());
+        nim_napi_set_object_value_double(isolate, item, "legacy_ns", legacy);
+        nim_napi_set_object_value_double(isolate, item, "current_ns", current);
+        result->Set(context, name, item);
+    }
+    args.GetReturnValue().Set(result);
+}
+
+static void releaseLiveStreamTask(nertc::NERtcLiveStreamTaskInfo& info)
+{
+    if (info.layout.users)
+    {
+        delete[] info.layout.users;
+        info.layout.users = nullptr;
+    }
+    if (info.layout.bg_image)
+    {
+        delete info.layout.bg_image;
+        info.layout.bg_image = nullptr;
+    }
+}
+
+// runLiveStream({ name: taskInfo }, iterations)：对每个推流任务对象测量 nertc_ls_task_info_obj_to_struct
+// 转换并释放一次的耗时，即 updateLiveStreamTask 调用 SDK 之前的全部开销
+static void RunLiveStream(const FunctionCallbackInfo<Value>& args)
+{
+    Isolate* isolate = args.GetIsolate();
+    Local<Context> context = isolate->GetCurrentContext();
+    if (args.Length() < 1 || !args[0]->IsObject())
+        return;
+    uint32_t iterations = 100000;
+    if (args.Length() > 1)
+        nim_napi_get_value_uint32(isolate, args[1], iterations);
+    if (iterations == 0)
+        iterations = 1;
+
+    Local<Object> cases = args[0].As<Object>();
+    Local<Array> names = cases->GetOwnPropertyNames(context).ToLocalChecked();
+    Local<Object> result = Object::New(isolate);
+    for (uint32_t i = 0; i < names->Length(); i++)
+    {
+        Local<Value> name = names->Get(context, i).ToLocalChecked();
+        Local<Value> task = cases->Get(context, name).ToLocalChecked();
+        if (!task->IsObject())
+            continue;
+        Local<Object> taskObj = task.As<Object>();
+        nertc::NERtcLiveStreamTaskInfo info = {};
+        if (nertc_ls_task_info_obj_to_struct(isolate, taskObj, info) != napi_ok)
+        {
+            releaseLiveStreamTask(info);
+            isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, "invalid task").ToLocalChecked()));
+            return;
+        }
+        int userCount = info.layout.user_count;
+        releaseLiveStreamTask(info);
+
+        double elapsed = measureLoop(iterations, [&]() {
+            nertc::NERtcLiveStreamTaskInfo info = {};
+            nertc_ls_task_info_obj_to_struct(isolate, taskObj, info);
+            releaseLiveStreamTask(info);
+        });
+        Local<Object> item = Object::New(isolate);
+        nim_napi_set_object_value_int32(isolate, item, "users", userCount);
+        nim_napi_set_object_value_double(isolate, item, "ns", elapsed);
+        result->Set(context, name, item);
+    }
+    args.GetReturnValue().Set(result);
+}
+
+static void InitBench(Local<Object> exports, Local<Value> module, Local<Context> context)
+{
+    nertc_init_stats_templates(context->GetIsolate());
+    NODE_SET_METHOD(exports, "run", Run);
+    NODE_SET_METHOD(exports, "runLazy", RunLazy);
+    NODE_SET_METHOD(exports, "runString", RunString);
+    NODE_SET_METHOD(exports, "runLiveStream", RunLiveStream);
+}
+
+NODE_MODULE_CONTEXT_AWARE(nertc_marshal_bench, InitBench)
@@ -0,0 +1,77 @@
+// 用法：node marshal_bench.js [iterations]
+const path = require('path')
+const bench = require(path.resolve(__dirname, 'build/Release/nertc-marshal-bench.node'))
+
+const iterations = parseInt(process.argv[2] || '100000', 10)
+const result = bench.run(iterations)
+console.log(`iterations: ${iterations}`)
+console.log('converter'.padEnd(20), 'uncached(ns)'.padStart(14), 'cached(ns)'.padStart(12), 'template(ns)'.padStart(14), 'saved'.padStart(8))
+Object.keys(result).forEach((name) => {
+  const { uncached_ns, cached_ns, template_ns } = result[name]
+  const saved = ((1 - template_ns / uncached_ns) * 100).toFixed(1) + '%'
+  console.log(name.padEnd(20), uncached_ns.toFixed(0).padStart(14), cached_ns.toFixed(0).padStart(12), template_ns.toFixed(0).padStart(14), saved.padStart(8))
+})
+
+console.log()
+console.log('NERtcStats'.padEnd(20), 'eager(ns)'.padStart(14), 'lazy(ns)'.padStart(12), 'saved'.padStart(8))
+const lazyResult = bench.runLazy(iterations)
+Object.keys(lazyResult).forEach((name) => {
+  const { eager_ns, lazy_ns } = lazyResult[name]
+  const saved = ((1 - lazy_ns / eager_ns) * 100).toFixed(1) + '%'
+  console.log(name.padEnd(20), eager_ns.toFixed(0).padStart(14), lazy_ns.toFixed(0).padStart(12), saved.padStart(8))
+})
+
+// 典型的字符串参数：频道名、设备 ID、中文设备名、推流地址
+const strings = {
+  channel_name: 'room-20231019-1234',
+  device_id: '{0.0.1.00000000}.{8c5d2a2f-6d32-4b7e-9f0e-3f6a1c2d4e5f}',
+  device_name: '麦克风 (USB Audio Device)',
+  stream_url: 'rtmp://push.example.com/live/' + 'a'.repeat(200) + '?txSecret=0123456789abcdef',
+  long_unicode: '直播推流任务'.repeat(40)
+}
+console.log()
+console.log('string'.padEnd(20), 'bytes'.padStart(8), 'legacy(ns)'.padStart(12), 'current(ns)'.padStart(12), 'saved'.padStart(8))
+const stringResult = bench.runString(strings, iterations)
+Object.keys(stringResult).forEach((name) => {
+  const { bytes, legacy_ns, current_ns } = stringResult[name]
+  const saved = ((1 - current_ns / legacy_ns) * 100).toFixed(1) + '%'
+  console.log(name.padEnd(20), String(bytes).padStart(8), legacy_ns.toFixed(0).padStart(12), current_ns.toFixed(0).padStart(12), saved.padStart(8))
+})
+
+// 直播推流任务：16 人宫格布局，分别以对象数组与 Float64Array（NERtcLiveStreamUserField）传入 users
+const { NERtcLiveStreamUserField: F } = require('../js/api/defs')
+const makeUsers = (count) => Array.from({ length: count }, (_, i) => ({
+  uid: 10000 + i, video_push: true, adaption: 1,
+  x: (i % 4) * 320, y: Math.floor(i / 4) * 180, width: 320, height: 180,
+  audio_push: true, z_order: i
+}))
+const encodeUsers = (users) => {
+  const data = new Float64Array(users.length * F.kNERtcLiveStreamUserFieldCount)
+  users.forEach((user, i) => {
+    const row = i * F.kNERtcLiveStreamUserFieldCount
+    data[row + F.kNERtcLiveStreamUserUid] = user.uid
+    data[row + F.kNERtcLiveStreamUserVideoPush] = user.video_push ? 1 : 0
+    data[row + F.kNERtcLiveStreamUserAdaption] = user.adaption
+    data[row + F.kNERtcLiveStreamUserX] = user.x
+    data[row + F.kNERtcLiveStreamUserY] = user.y
+    data[row + F.kNERtcLiveStreamUserWidth] = user.width
+    data[row + F.kNERtcLiveStreamUserHeight] = user.height
+    data[row + F.kNERtcLiveStreamUserAudioPush] = user.audio_push ? 1 : 0
+    data[row + F.kNERtcLiveStreamUserZOrder] = user.z_order
+  })
+  return data
+}
+const makeTask = (users) => ({
+  task_id: 'task-1', stream_url: 'rtmp://push.example.com/live/room-1', server_record_enabled: false, ls_mode: 0,
+  layout: { width: 1280, height: 720, background_color: 0, user_count: 16, users, bg_image: { url: '', x: 0, y: 0, width: 0, height: 0 } },
+  config: { single_video_passthrough: false, audio_bitrate: 64, sample_rate: 48000, channels: 2, audio_codec_profile: 0 }
+})
+const users = makeUsers(16)
+const tasks = { objects_16: makeTask(users), table_16: makeTask(encodeUsers(users)) }
+console.log()
+console.log('live stream task'.padEnd(20), 'users'.padStart(8), 'ns/update'.padStart(12), 'updates/s'.padStart(12))
+const liveResult = bench.runLiveStream(tasks, iterations)
+Object.keys(liveResult).forEach((name) => {
+  const { users, ns } = liveResult[name]
+  console.log(name.padEnd(20), String(users).padStart(8), ns.toFixed(0).padStart(12), (1e9 / ns).toFixed(0).padStart(12))
+})
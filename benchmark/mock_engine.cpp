@@ -0,0 +1,490 @@
+// 离线负载源：代替 SDK 按设定的人数与频率合成远端用户的 I420 视频帧、PCM、统计、音量与 SEI，
+// 直接调用绑定层的画布回调与事件/统计处理对象，不链接 SDK 库即可对各条 native 路径做压力测试。
+// 同时导出基于 fake_sdk 假引擎的 NertcNodeEngine，覆盖 SEI 发送、直播布局更新等主动调用路径。
+// 构建与运行方式见 benchmark/README.md
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../nertc_sdk_node/nertc_node_engine.h"
+#include "../nertc_sdk_node/nertc_node_engine_event_handler.h"
+#include "../nertc_sdk_node/nertc_node_stats_template.h"
+#include "../nertc_sdk_node/nertc_node_video_frame_provider.h"
+#include "../shared/sdk_helper/nim_node_helper.h"
+#include "fake_sdk/fake_rtc_engine.h"
+
+using namespace nertc_node;
+
+namespace
+{
+const nertc::uid_t kFirstRemoteUid = 1001;
+const uint32_t kPcmSampleRate = 48000;
+
+struct MockOptions
+{
+    uint32_t users = 4;          // 远端用户数，uid 从 kFirstRemoteUid 起连续分配
+    uint32_t substreamUsers = 0; // 前若干个用户同时发送辅流
+    bool local = false;          // 是否同时产生本地预览帧
+    uint32_t width = 640;
+    uint32_t height = 360;
+    uint32_t stridePadding = 0; // 每行额外的填充字节，模拟带对齐的解码输出
+    uint32_t fps = 15;
+    uint32_t statsInterval = 2000; // ms，0 表示不产生
+    uint32_t volumeInterval = 200;
+    uint32_t seiInterval = 0;
+    uint32_t seiSize = 32;
+};
+
+struct MockStream
+{
+    NodeVideoCanvasContext *context;
+    bool substream;
+    std::vector<uint8_t> buffer;
+    uint32_t offset[4];
+    uint32_t stride[4];
+};
+
+// 回调线程与 SDK 一致：视频帧在独立的渲染线程上同步回调，事件与统计在另一线程上回调
+class MockMediaSource
+{
+public:
+    MockMediaSource() : running_(false), video_frames_(0), events_(0), pcm_phase_(0) {}
+    ~MockMediaSource() { stop(); }
+
+    void start(const MockOptions &options);
+    void stop();
+    void fillPcm(int16_t *samples, size_t count);
+    uint64_t videoFrames() const { return video_frames_; }
+    uint64_t events() const { return events_; }
+
+private:
+    void addStream(NodeRenderType type, nertc::uid_t uid);
+    void renderFrame(MockStream &stream, uint32_t seq);
+    void videoLoop();
+    void eventLoop();
+    void emitStats(uint32_t seq);
+    void emitVolume(uint32_t seq);
+    void emitSEI(uint32_t seq);
+
+    MockOptions options_;
+    std::vector<nertc::uid_t> uids_;
+    std::vector<MockStream> streams_;
+    std::atomic<bool> running_;
+    std::thread video_thread_;
+    std::thread event_thread_;
+    std::atomic<uint64_t> video_frames_;
+    std::atomic<uint64_t> events_;
+    std::mutex pcm_lock_;
+    uint64_t pcm_phase_;
+};
+
+MockMediaSource g_source;
+
+void MockMediaSource::start(const MockOptions &options)
+{
+    stop();
+    options_ = options;
+    if (options_.fps == 0)
+        options_.fps = 1;
+    options_.width &= ~1u;
+    options_.height &= ~1u;
+    uids_.clear();
+    streams_.clear();
+    video_frames_ = 0;
+    events_ = 0;
+    NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+    NertcNodeEventHandler *handler = NertcNodeEventHandler::GetInstance();
+    for (uint32_t i = 0; i < options_.users; i++)
+    {
+        nertc::uid_t uid = kFirstRemoteUid + i;
+        uids_.push_back(uid);
+        handler->onUserJoined(uid, ("mock-" + std::to_string(uid)).c_str());
+        handler->onUserVideoStart(uid, (nertc::NERtcVideoProfileType)2);
+        addStream(NODE_RENDER_TYPE_REMOTE, uid);
+        if (i < options_.substreamUsers)
+        {
+            handler->onUserSubStreamVideoStart(uid, (nertc::NERtcVideoProfileType)2);
+            addStream(NODE_RENDER_TYPE_REMOTE_SUBSTREAM, uid);
+        }
+    }
+    if (options_.local)
+        addStream(NODE_RENDER_TYPE_LOCAL, 0);
+    pTransporter->setChannelName("mock-channel");
+    running_ = true;
+    video_thread_ = std::thread(&MockMediaSource::videoLoop, this);
+    event_thread_ = std::thread(&MockMediaSource::eventLoop, this);
+}
+
+void MockMediaSource::stop()
+{
+    if (!running_)
+        return;
+    running_ = false;
+    video_thread_.join();
+    event_thread_.join();
+    NertcNodeEventHandler *handler = NertcNodeEventHandler::GetInstance();
+    for (nertc::uid_t uid : uids_)
+        handler->onUserLeft(uid, (nertc::NERtcSessionLeaveReason)0);
+}
+
+void MockMediaSource::addStream(NodeRenderType type, nertc::uid_t uid)
+{
+    MockStream stream;
+    stream.context = getNodeVideoFrameTransporter()->getVideoCanvasContext(type, uid, "");
+    stream.substream = type == NODE_RENDER_TYPE_REMOTE_SUBSTREAM || type == NODE_RENDER_TYPE_LOCAL_SUBSTREAM;
+    uint32_t strideY = options_.width + options_.stridePadding;
+    uint32_t strideUV = options_.width / 2 + options_.stridePadding / 2;
+    uint32_t sizeY = strideY * options_.height;
+    uint32_t sizeUV = strideUV * options_.height / 2;
+    stream.offset[0] = 0;
+    stream.offset[1] = sizeY;
+    stream.offset[2] = sizeY + sizeUV;
+    stream.offset[3] = 0;
+    stream.stride[0] = strideY;
+    stream.stride[1] = strideUV;
+    stream.stride[2] = strideUV;
+    stream.stride[3] = 0;
+    stream.buffer.assign(sizeY + sizeUV * 2, 128);
+    // 每路流的底色不同，便于在渲染结果中区分
+    memset(stream.buffer.data(), (int)(32 + (uid * 37) % 192), sizeY);
+    streams_.push_back(std::move(stream));
+}
+
+// 每帧只改写一条移动的亮带，内容逐帧变化但生成开销远低于被测的拷贝路径
+void MockMediaSource::renderFrame(MockStream &stream, uint32_t seq)
+{
+    const uint32_t band = 8;
+    uint32_t height = options_.height;
+    uint32_t previous = ((seq + height / band - 1) % (height / band)) * band;
+    uint32_t current = (seq % (height / band)) * band;
+    uint8_t base = stream.buffer[stream.stride[0] * ((current + band) % height)];
+    for (uint32_t row = 0; row < band && previous + row < height; row++)
+        memset(stream.buffer.data() + stream.stride[0] * (previous + row), base, options_.width);
+    for (uint32_t row = 0; row < band && current + row < height; row++)
+        memset(stream.buffer.data() + stream.stride[0] * (current + row), 235, options_.width);
+}
+
+void MockMediaSource::videoLoop()
+{
+    auto interval = std::chrono::microseconds(1000000 / options_.fps);
+    auto next = std::chrono::steady_clock::now();
+    uint32_t seq = 0;
+    while (running_)
+    {
+        for (auto &stream : streams_)
+        {
+            renderFrame(stream, seq);
+            auto callback = stream.substream ? NodeVideoFrameTransporter::onSubstreamFrameDataCallback : NodeVideoFrameTransporter::onFrameDataCallback;
+            callback(stream.context->uid, stream.buffer.data(), 0, options_.width, options_.height, 3,
+                     stream.offset, stream.stride, nertc::kNERtcVideoRotation_0, stream.context);
+            ++video_frames_;
+        }
+        ++seq;
+        next += interval;
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void MockMediaSource::eventLoop()
+{
+    const uint32_t tick = 5;
+    uint32_t elapsed = 0;
+    uint32_t seq = 0;
+    while (running_)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(tick));
+        elapsed += tick;
+        ++seq;
+        if (options_.statsInterval && elapsed % options_.statsInterval < tick)
+            emitStats(seq);
+        if (options_.volumeInterval && elapsed % options_.volumeInterval < tick)
+            emitVolume(seq);
+        if (options_.seiInterval && elapsed % options_.seiInterval < tick)
+            emitSEI(seq);
+    }
+}
+
+void MockMediaSource::emitStats(uint32_t seq)
+{
+    NertcNodeRtcMediaStatsHandler *handler = NertcNodeRtcMediaStatsHandler::GetInstance();
+    uint32_t count = (uint32_t)uids_.size();
+
+    nertc::NERtcStats stats = {};
+    stats.cpu_app_usage = 10 + seq % 5;
+    stats.total_duration = (int)(seq / 200);
+    stats.rx_bytes = (uint64_t)seq * 1024 * count;
+    stats.rx_video_kbitrate = (int)(600 * count);
+    stats.up_rtt = stats.down_rtt = 30 + seq % 7;
+    handler->onRtcStats(stats);
+
+    std::vector<nertc::NERtcVideoLayerRecvStats> layers(count);
+    std::vector<nertc::NERtcVideoRecvStats> video(count);
+    std::vector<nertc::NERtcAudioRecvStats> audio(count);
+    std::vector<nertc::NERtcNetworkQualityInfo> quality(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        layers[i] = {};
+        layers[i].width = options_.width;
+        layers[i].height = options_.height;
+        layers[i].received_bitrate = 600;
+        layers[i].received_frame_rate = layers[i].decoder_frame_rate = layers[i].render_frame_rate = options_.fps;
+        video[i] = {};
+        video[i].uid = uids_[i];
+        video[i].video_layers_list = &layers[i];
+        video[i].video_layers_count = 1;
+        audio[i] = {};
+        audio[i].uid = uids_[i];
+        audio[i].received_bitrate = 48;
+        audio[i].volume = (seq + i * 13) % 100;
+        quality[i] = {};
+        quality[i].uid = uids_[i];
+        quality[i].tx_quality = quality[i].rx_quality = (nertc::NERtcNetworkQualityType)(1 + (seq + i) % 3);
+    }
+    if (count > 0)
+    {
+        handler->onRemoteVideoStats(video.data(), count);
+        handler->onRemoteAudioStats(audio.data(), count);
+        handler->onNetworkQuality(quality.data(), count);
+    }
+    events_ += count > 0 ? 4 : 1;
+}
+
+void MockMediaSource::emitVolume(uint32_t seq)
+{
+    std::vector<nertc::NERtcAudioVolumeInfo> speakers(uids_.size());
+    int total = 0;
+    for (size_t i = 0; i < uids_.size(); i++)
+    {
+        speakers[i].uid = uids_[i];
+        speakers[i].volume = (uint32_t)((seq * 7 + i * 31) % 100);
+        total = std::max(total, (int)speakers[i].volume);
+    }
+    NertcNodeEventHandler *handler = NertcNodeEventHandler::GetInstance();
+    handler->onRemoteAudioVolumeIndication(speakers.data(), (unsigned int)speakers.size(), total);
+    handler->onLocalAudioVolumeIndication((int)(seq % 100));
+    events_ += 2;
+}
+
+void MockMediaSource::emitSEI(uint32_t seq)
+{
+    std::string payload(options_.seiSize, '\0');
+    NertcNodeEventHandler *handler = NertcNodeEventHandler::GetInstance();
+    for (nertc::uid_t uid : uids_)
+    {
+        std::string tag = std::to_string(uid) + ":" + std::to_string(seq);
+        payload.replace(0, std::min(tag.size(), payload.size()), tag, 0, std::min(tag.size(), payload.size()));
+        handler->onRecvSEIMsg(uid, payload.data(), (uint32_t)payload.size());
+        ++events_;
+    }
+}
+
+// 440Hz 单声道正弦波，连续调用时相位连续
+void MockMediaSource::fillPcm(int16_t *samples, size_t count)
+{
+    std::lock_guard<std::mutex> lck(pcm_lock_);
+    const double step = 2 * 3.14159265358979 * 440 / kPcmSampleRate;
+    for (size_t i = 0; i < count; i++)
+        samples[i] = (int16_t)(std::sin(step * (double)(pcm_phase_ + i)) * 8000);
+    pcm_phase_ += count;
+}
+
+void OnVideoFrame(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    if (args.Length() < 1 || !args[0]->IsFunction())
+        return;
+    getNodeVideoFrameTransporter()->initialize(isolate, args);
+}
+
+void OnEvent(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    if (args.Length() < 2 || !args[1]->IsFunction())
+        return;
+    UTF8String eventName;
+    if (nim_napi_get_value_utf8string(isolate, args[0], eventName) != napi_ok || eventName.length() == 0)
+        return;
+    ASSEMBLE_REG_CALLBACK(1, NertcNodeEventHandler, eventName.toUtf8String())
+}
+
+void OnStatsObserver(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    if (args.Length() < 3)
+        return;
+    UTF8String eventName;
+    bool enable = false;
+    if (nim_napi_get_value_utf8string(isolate, args[0], eventName) != napi_ok || eventName.length() == 0 ||
+        nim_napi_get_value_bool(isolate, args[1], enable) != napi_ok)
+        return;
+    if (!enable)
+    {
+        NertcNodeRtcMediaStatsHandler::GetInstance()->RemoveEventHandler(eventName.toUtf8String());
+        return;
+    }
+    if (!args[2]->IsFunction())
+        return;
+    ASSEMBLE_REG_CALLBACK(2, NertcNodeRtcMediaStatsHandler, eventName.toUtf8String())
+}
+
+void EnableLazyStats(const FunctionCallbackInfo<Value> &args)
+{
+    bool enable = false;
+    if (args.Length() > 0)
+        nim_napi_get_value_bool(args.GetIsolate(), args[0], enable);
+    NertcNodeRtcMediaStatsHandler::GetInstance()->SetLazyStats(enable);
+}
+
+void EnableVideoFrameSEIAttachment(const FunctionCallbackInfo<Value> &args)
+{
+    bool enable = false;
+    if (args.Length() > 0)
+        nim_napi_get_value_bool(args.GetIsolate(), args[0], enable);
+    getNodeVideoFrameTransporter()->setAttachSEIToFrame(enable);
+}
+
+void EnableVideoLatencyStats(const FunctionCallbackInfo<Value> &args)
+{
+    bool enable = false;
+    if (args.Length() > 0)
+        nim_napi_get_value_bool(args.GetIsolate(), args[0], enable);
+    getNodeVideoFrameTransporter()->setLatencyStats(enable);
+}
+
+// 与引擎的 reportVideoFrameRendered 相同，在 onVideoFrame 回调中同步调用
+void ReportVideoFrameRendered(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    uint64_t uid = 0;
+    uint32_t streamType = 0, timestamp = 0;
+    if (args.Length() < 3 || nim_napi_get_value_uint64(isolate, args[0], uid) != napi_ok ||
+        nim_napi_get_value_uint32(isolate, args[1], streamType) != napi_ok || nim_napi_get_value_uint32(isolate, args[2], timestamp) != napi_ok)
+    {
+        args.GetReturnValue().Set(Integer::New(isolate, -1));
+        return;
+    }
+    getNodeVideoFrameTransporter()->onVideoFrameRendered(getNodeRenderType(uid, streamType), uid, timestamp);
+    args.GetReturnValue().Set(Integer::New(isolate, 0));
+}
+
+// 返回 [arriveToDeliver, deliverToRender, arriveToRender] 三组直方图的 p50/p99/count
+void GetVideoLatencyStats(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    Local<Context> context = isolate->GetCurrentContext();
+    uint64_t uid = 0;
+    uint32_t streamType = 0;
+    if (args.Length() < 2 || nim_napi_get_value_uint64(isolate, args[0], uid) != napi_ok || nim_napi_get_value_uint32(isolate, args[1], streamType) != napi_ok)
+        return;
+    NodeLatencyHistogram histograms[3];
+    getNodeVideoFrameTransporter()->getLatencyStats(getNodeRenderType(uid, streamType), uid, histograms[0], histograms[1], histograms[2]);
+    Local<Array> result = Array::New(isolate, 3);
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        Local<Object> obj = Object::New(isolate);
+        nim_napi_set_object_value_uint64(isolate, obj, "count", histograms[i].count());
+        nim_napi_set_object_value_uint32(isolate, obj, "p50", histograms[i].percentile(0.5));
+        nim_napi_set_object_value_uint32(isolate, obj, "p99", histograms[i].percentile(0.99));
+        result->Set(context, i, obj);
+    }
+    args.GetReturnValue().Set(result);
+}
+
+// 与引擎的 pullExternalAudioFrame 相同的投递路径，数据由负载源合成
+void PullExternalAudioFrame(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    int length = 0;
+    if (args.Length() < 2 || !args[1]->IsFunction() || nim_napi_get_value_int32(isolate, args[0], length) != napi_ok || length <= 0)
+    {
+        args.GetReturnValue().Set(Integer::New(isolate, -1));
+        return;
+    }
+    ASSEMBLE_BASE_CALLBACK(1);
+    std::shared_ptr<unsigned char> shared_data(new unsigned char[length], std::default_delete<unsigned char[]>());
+    g_source.fillPcm(reinterpret_cast<int16_t *>(shared_data.get()), length / sizeof(int16_t));
+    NertcNodeEventHandler::GetInstance()->onPullExternalAudioFrame(bcb, shared_data, length);
+    args.GetReturnValue().Set(Integer::New(isolate, 0));
+}
+
+void Start(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    MockOptions options;
+    if (args.Length() > 0 && args[0]->IsObject())
+    {
+        Local<Object> obj = args[0].As<Object>();
+        nim_napi_get_object_value_uint32(isolate, obj, "users", options.users);
+        nim_napi_get_object_value_uint32(isolate, obj, "substream_users", options.substreamUsers);
+        nim_napi_get_object_value_bool(isolate, obj, "local", options.local);
+        nim_napi_get_object_value_uint32(isolate, obj, "width", options.width);
+        nim_napi_get_object_value_uint32(isolate, obj, "height", options.height);
+        nim_napi_get_object_value_uint32(isolate, obj, "stride_padding", options.stridePadding);
+        nim_napi_get_object_value_uint32(isolate, obj, "fps", options.fps);
+        nim_napi_get_object_value_uint32(isolate, obj, "stats_interval", options.statsInterval);
+        nim_napi_get_object_value_uint32(isolate, obj, "volume_interval", options.volumeInterval);
+        nim_napi_get_object_value_uint32(isolate, obj, "sei_interval", options.seiInterval);
+        nim_napi_get_object_value_uint32(isolate, obj, "sei_size", options.seiSize);
+    }
+    if (options.width < 16 || options.height < 16)
+    {
+        args.GetReturnValue().Set(Integer::New(isolate, -1));
+        return;
+    }
+    g_source.start(options);
+    args.GetReturnValue().Set(Integer::New(isolate, 0));
+}
+
+void Stop(const FunctionCallbackInfo<Value> &args)
+{
+    g_source.stop();
+}
+
+void GetCounters(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    Local<Object> obj = Object::New(isolate);
+    nim_napi_set_object_value_uint64(isolate, obj, "video_frames", g_source.videoFrames());
+    nim_napi_set_object_value_uint64(isolate, obj, "events", g_source.events());
+    args.GetReturnValue().Set(obj);
+}
+
+// 假引擎收到的主动调用，见 fake_sdk/fake_rtc_engine.h
+void GetEngineCounters(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    nertc_fake::FakeRtcEngineCounters counters = nertc_fake::getFakeRtcEngineCounters();
+    Local<Object> obj = Object::New(isolate);
+    nim_napi_set_object_value_uint64(isolate, obj, "sei_messages", counters.sei_messages);
+    nim_napi_set_object_value_uint64(isolate, obj, "sei_bytes", counters.sei_bytes);
+    nim_napi_set_object_value_uint64(isolate, obj, "live_stream_updates", counters.live_stream_updates);
+    nim_napi_set_object_value_uint32(isolate, obj, "live_stream_users", counters.live_stream_users);
+    nim_napi_set_object_value_uint64(isolate, obj, "pcm_frames", counters.pcm_frames);
+    nim_napi_set_object_value_uint64(isolate, obj, "pcm_bytes", counters.pcm_bytes);
+    args.GetReturnValue().Set(obj);
+}
+
+void InitMock(Local<Object> exports, Local<Value> module, Local<Context> context)
+{
+    // 同时生成统计对象模板
+    NertcNodeEngine::InitModule(exports, module, context);
+    NODE_SET_METHOD(exports, "onVideoFrame", OnVideoFrame);
+    NODE_SET_METHOD(exports, "onEvent", OnEvent);
+    NODE_SET_METHOD(exports, "onStatsObserver", OnStatsObserver);
+    NODE_SET_METHOD(exports, "enableLazyStats", EnableLazyStats);
+    NODE_SET_METHOD(exports, "enableVideoFrameSEIAttachment", EnableVideoFrameSEIAttachment);
+    NODE_SET_METHOD(exports, "enableVideoLatencyStats", EnableVideoLatencyStats);
+    NODE_SET_METHOD(exports, "reportVideoFrameRendered", ReportVideoFrameRendered);
+    NODE_SET_METHOD(exports, "getVideoLatencyStats", GetVideoLatencyStats);
+    NODE_SET_METHOD(exports, "pullExternalAudioFrame", PullExternalAudioFrame);
+    NODE_SET_METHOD(exports, "start", Start);
+    NODE_SET_METHOD(exports, "stop", Stop);
+    NODE_SET_METHOD(exports, "getCounters", GetCounters);
+    NODE_SET_METHOD(exports, "getEngineCounters", GetEngineCounters);
+}
+} // namespace
+
+NODE_MODULE_CONTEXT_AWARE(nertc_mock_engine, InitMock)
@@ -0,0 +1,197 @@
+// 用法：node mock_load.js [key=value ...]，可选项见 defaults，例如
+// node mock_load.js users=16 width=1280 height=720 fps=30 duration=10
+const path = require('path')
+const mock = require(path.resolve(__dirname, 'build/Release/nertc-mock-engine.node'))
+
+const defaults = {
+  users: 4,
+  substream_users: 0,
+  local: 0,
+  width: 640,
+  height: 360,
+  stride_padding: 0,
+  fps: 15,
+  stats_interval: 2000,
+  volume_interval: 200,
+  sei_interval: 0,
+  sei_size: 32,
+  sei_attach: 0, // 是否把 SEI 挂到视频帧上
+  pcm_interval: 10, // ms，0 表示不拉取 PCM
+  pcm_bytes: 1920, // 48kHz 单声道 10ms
+  lazy_stats: 0,
+  latency: 0, // 开启时延统计，并像 doVideoFrameReceived 一样在回调中逐帧上报渲染
+  engine_pcm: 0, // 经 NertcNodeEngine.pullExternalAudioFrame 从假引擎拉取 PCM
+  sei_send_interval: 0, // ms，每隔多久调用一次 sendSEIMsgBatch，0 表示不发送
+  sei_send_batch: 4,
+  sei_send_rate: 10, // setSEISendRate
+  ls_users: 0, // 直播任务的成员数，0 表示不推流
+  ls_interval: 100, // ms，每隔多久调用一次 updateLiveStreamUsers 移动一个成员
+  duration: 5 // s
+}
+const options = Object.assign({}, defaults)
+process.argv.slice(2).forEach((arg) => {
+  const [key, value] = arg.split('=')
+  if (!(key in defaults)) {
+    console.error(`unknown option: ${key}`)
+    process.exit(1)
+  }
+  options[key] = Number(value)
+})
+
+const counters = { frames: 0, frame_bytes: 0, sei_frames: 0, events: 0, stats: 0, pcm_bytes: 0 }
+mock.onVideoFrame((infos) => {
+  // 与 doVideoFrameReceived 相同的取值，不做绘制
+  for (let i = 0; i < infos.length; i++) {
+    const { type, uid, header, ydata, udata, vdata, sei } = infos[i]
+    counters.frame_bytes += header.byteLength + ydata.byteLength + udata.byteLength + vdata.byteLength
+    if (options.latency) {
+      const streamType = (type === 2 || type === 3) ? 1 : 0
+      mock.reportVideoFrameRendered(uid, streamType, new DataView(header).getUint32(16))
+    }
+    if (sei) {
+      counters.sei_frames++
+    }
+  }
+  counters.frames += infos.length
+})
+const events = ['onUserJoined', 'onUserLeft', 'onUserVideoStart', 'onUserSubStreamVideoStart', 'onLocalAudioVolumeIndication',
+  'onRemoteAudioVolumeIndication', 'onReceSEIMsg', 'onReceSEIMsgBatch']
+events.forEach((name) => mock.onEvent(name, () => { counters.events++ }))
+const statsEvents = ['onRtcStats', 'onRemoteAudioStats', 'onRemoteVideoStats', 'onNetworkQuality']
+statsEvents.forEach((name) => mock.onStatsObserver(name, true, (stats) => {
+  // 读取一个字段，按需取值对象也会走一次转换
+  counters.stats++
+  return stats && stats.length
+}))
+mock.enableLazyStats(!!options.lazy_stats)
+mock.enableVideoFrameSEIAttachment(!!options.sei_attach)
+mock.enableVideoLatencyStats(!!options.latency)
+
+// 主动调用经绑定层的 NertcNodeEngine 交给 fake_sdk 中的假引擎
+const engine = new mock.NertcNodeEngine()
+if (engine.initialize({ app_key: 'mock', log_dir_path: '' }) !== 0) {
+  console.error('engine initialize failed')
+  process.exit(1)
+}
+const outbound = { sei_enqueued: 0, ls_failed: 0 }
+const timers = []
+if (options.sei_send_interval > 0) {
+  engine.setSEISendRate(options.sei_send_rate)
+  let seq = 0
+  timers.push(setInterval(() => {
+    const batch = Array.from({ length: options.sei_send_batch }, () => Buffer.from(`sei:${seq++}`.padEnd(options.sei_size, ' ')))
+    outbound.sei_enqueued += Math.max(0, engine.sendSEIMsgBatch(batch, 0))
+  }, options.sei_send_interval))
+}
+if (options.ls_users > 0) {
+  const { NERtcLiveStreamUserField: F } = require('../js/api/defs')
+  const stride = F.kNERtcLiveStreamUserFieldCount
+  const columns = Math.ceil(Math.sqrt(options.ls_users))
+  const cellWidth = Math.floor(1280 / columns)
+  const cellHeight = Math.floor(720 / columns)
+  const users = new Float64Array(options.ls_users * stride)
+  for (let i = 0; i < options.ls_users; i++) {
+    const row = i * stride
+    users[row + F.kNERtcLiveStreamUserUid] = 1001 + i
+    users[row + F.kNERtcLiveStreamUserVideoPush] = 1
+    users[row + F.kNERtcLiveStreamUserAdaption] = 0
+    users[row + F.kNERtcLiveStreamUserX] = (i % columns) * cellWidth
+    users[row + F.kNERtcLiveStreamUserY] = Math.floor(i / columns) * cellHeight
+    users[row + F.kNERtcLiveStreamUserWidth] = cellWidth
+    users[row + F.kNERtcLiveStreamUserHeight] = cellHeight
+    users[row + F.kNERtcLiveStreamUserAudioPush] = 1
+    users[row + F.kNERtcLiveStreamUserZOrder] = i
+  }
+  const task = {
+    task_id: 'mock-task', stream_url: 'rtmp://push.example.com/live/mock', server_record_enabled: false, ls_mode: 0,
+    layout: { width: 1280, height: 720, background_color: 0, user_count: options.ls_users, users, bg_image: { url: '', x: 0, y: 0, width: 0, height: 0 } },
+    config: { single_video_passthrough: false, audio_bitrate: 64, sample_rate: 48000, channels: 2, audio_codec_profile: 0 }
+  }
+  if (engine.addLiveStreamTask(task) !== 0) {
+    console.error('addLiveStreamTask failed')
+    process.exit(1)
+  }
+  // 每次只改一个成员的 z_order，其余字段为 NaN 保持不变
+  const change = new Float64Array(stride).fill(NaN)
+  let seq = 0
+  timers.push(setInterval(() => {
+    change[F.kNERtcLiveStreamUserUid] = 1001 + seq % options.ls_users
+    change[F.kNERtcLiveStreamUserZOrder] = options.ls_users + seq++
+    if (engine.updateLiveStreamUsers('mock-task', change, []) !== 0) {
+      outbound.ls_failed++
+    }
+  }, options.ls_interval))
+}
+
+// 事件循环时延：定时器实际触发时间与预期之差
+const lag = []
+let expected = Date.now() + 10
+const lagTimer = setInterval(() => {
+  const now = Date.now()
+  lag.push(Math.max(0, now - expected))
+  expected = now + 10
+}, 10)
+let pcmTimer = null
+if (options.pcm_interval > 0) {
+  const source = options.engine_pcm ? engine : mock
+  pcmTimer = setInterval(() => {
+    source.pullExternalAudioFrame(options.pcm_bytes, (buffer) => { counters.pcm_bytes += buffer.byteLength })
+  }, options.pcm_interval)
+}
+
+const cpuBegin = process.cpuUsage()
+const begin = process.hrtime.bigint()
+if (mock.start(Object.assign({}, options, { local: !!options.local })) !== 0) {
+  console.error('invalid options')
+  process.exit(1)
+}
+setTimeout(() => {
+  mock.stop()
+  clearInterval(lagTimer)
+  if (pcmTimer) {
+    clearInterval(pcmTimer)
+  }
+  timers.forEach((timer) => clearInterval(timer))
+  const seconds = Number(process.hrtime.bigint() - begin) / 1e9
+  const cpu = process.cpuUsage(cpuBegin)
+  const generated = mock.getCounters()
+  lag.sort((a, b) => a - b)
+  const percentile = (p) => lag.length ? lag[Math.min(lag.length - 1, Math.floor(lag.length * p))] : 0
+  console.log(JSON.stringify(options))
+  console.log('metric'.padEnd(24), 'value'.padStart(14))
+  const rows = {
+    'generated_fps': (generated.video_frames / seconds).toFixed(1),
+    'delivered_fps': (counters.frames / seconds).toFixed(1),
+    'delivered_MB/s': (counters.frame_bytes / seconds / 1048576).toFixed(2),
+    'sei_frames': counters.sei_frames,
+    'events/s': (counters.events / seconds).toFixed(1),
+    'stats/s': (counters.stats / seconds).toFixed(1),
+    'pcm_KB/s': (counters.pcm_bytes / seconds / 1024).toFixed(1),
+    'cpu_user%': (cpu.user / 1e4 / seconds).toFixed(1),
+    'cpu_system%': (cpu.system / 1e4 / seconds).toFixed(1),
+    'loop_lag_p50(ms)': percentile(0.5),
+    'loop_lag_p99(ms)': percentile(0.99),
+    'loop_lag_max(ms)': lag.length ? lag[lag.length - 1] : 0
+  }
+  if (options.latency) {
+    // 第一个远端用户的主流
+    const [arriveToDeliver, deliverToRender] = mock.getVideoLatencyStats(1001, 0)
+    rows['rendered_frames'] = deliverToRender.count
+    rows['deliver_lag_p99(ms)'] = arriveToDeliver.p99
+  }
+  const sent = mock.getEngineCounters()
+  if (options.sei_send_interval > 0) {
+    rows['sei_enqueued'] = outbound.sei_enqueued
+    rows['sei_sent/s'] = (sent.sei_messages / seconds).toFixed(1)
+  }
+  if (options.ls_users > 0) {
+    rows['ls_updates/s'] = (sent.live_stream_updates / seconds).toFixed(1)
+    rows['ls_users'] = sent.live_stream_users
+    rows['ls_failed'] = outbound.ls_failed
+  }
+  if (options.engine_pcm) {
+    rows['engine_pcm_frames'] = sent.pcm_frames
+  }
+  Object.keys(rows).forEach((name) => console.log(name.padEnd(24), String(rows[name]).padStart(14)))
+  process.exit(0)
+}, options.duration * 1000)
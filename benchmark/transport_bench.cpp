@@ -0,0 +1,399 @@
+// 视频传输路径的性能测试：合成 180p 至 4K 的 I420 帧，分别测量 copyAndCentreYuv、copyFrame、deliverFrame_I420
+// （多路流与多线程并发）与 FlushVideo 中投递给 JS 的 drain，输出每帧纳秒数与 GB/s。
+// 写法与 Google Benchmark 相同：用例在 keepRunning() 循环中执行，迭代次数自动增加到耗时超过最短时间。构建与运行方式见 benchmark/README.md
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../nertc_sdk_node/nertc_node_video_frame_copy.h"
+#include "../nertc_sdk_node/nertc_node_video_frame_provider.h"
+#include "../shared/sdk_helper/nim_node_helper.h"
+
+namespace nertc_node
+{
+
+struct BenchResolution
+{
+    const char *name;
+    int width;
+    int height;
+};
+
+static const BenchResolution kResolutions[] = {
+    {"180p", 320, 180},
+    {"360p", 640, 360},
+    {"720p", 1280, 720},
+    {"1080p", 1920, 1080},
+    {"4k", 3840, 2160},
+};
+static const int kStridePadding = 64; // stride 用例每行的填充字节，模拟解码器按 64 字节对齐的输出
+
+// 各滤波档位的缩放用例，与 README.md 中“视频缩放滤波档位参考”的行对应
+struct BenchScale
+{
+    BenchResolution source;
+    BenchResolution target;
+};
+
+static const BenchScale kScaleCases[] = {
+    {{"1080p", 1920, 1080}, {"720p", 1280, 720}},
+    {{"1080p", 1920, 1080}, {"540p", 960, 540}},
+    {{"1080p", 1920, 1080}, {"360p", 640, 360}},
+    {{"1080p", 1920, 1080}, {"180p", 320, 180}},
+    {{"720p", 1280, 720}, {"1080p", 1920, 1080}},
+    {{"720p", 1280, 720}, {"360p", 640, 360}},
+    {{"720p", 1280, 720}, {"180p", 320, 180}},
+    {{"360p", 640, 360}, {"180p", 320, 180}},
+};
+static const char *const kScaleFilterNames[] = {"none", "linear", "bilinear", "box"};
+
+// 对应 benchmark::State：被测代码放在 keepRunning() 循环中，计时从第一次调用开始到循环结束
+class BenchState
+{
+public:
+    explicit BenchState(uint64_t iterations)
+        : iterations_(iterations), remaining_(iterations), items_(iterations), bytes_(0), seconds_(0), manual_(false)
+    {
+    }
+
+    uint64_t iterations() const { return iterations_; }
+
+    bool keepRunning()
+    {
+        if (remaining_ == iterations_)
+            begin_ = std::chrono::steady_clock::now();
+        if (remaining_ == 0)
+        {
+            if (!manual_)
+                seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin_).count();
+            return false;
+        }
+        --remaining_;
+        return true;
+    }
+
+    // 多线程用例自行计时，不经过 keepRunning
+    void setManualTime(double seconds)
+    {
+        manual_ = true;
+        seconds_ = seconds;
+    }
+    void setItemsProcessed(uint64_t items) { items_ = items; }
+    void setBytesProcessed(uint64_t bytes) { bytes_ = bytes; }
+
+    double seconds() const { return seconds_; }
+    uint64_t items() const { return items_; }
+    uint64_t bytes() const { return bytes_; }
+
+private:
+    uint64_t iterations_;
+    uint64_t remaining_;
+    uint64_t items_;
+    uint64_t bytes_;
+    double seconds_;
+    bool manual_;
+    std::chrono::steady_clock::time_point begin_;
+};
+
+struct BenchCase
+{
+    std::string name;
+    std::function<void(BenchState &)> fn;
+};
+
+// 合成的 I420 帧，亮度为对角渐变；padded 时每行带 kStridePadding 字节填充
+struct SyntheticFrame
+{
+    std::vector<uint8_t> data;
+    IVideoFrame frame;
+
+    SyntheticFrame(int width, int height, bool padded)
+    {
+        uint32_t strideY = width + (padded ? kStridePadding : 0);
+        uint32_t strideUV = strideY / 2;
+        uint32_t sizeY = strideY * height;
+        uint32_t sizeUV = strideUV * height / 2;
+        data.assign(sizeY + sizeUV * 2, 128);
+        for (int row = 0; row < height; row++)
+            for (int col = 0; col < width; col++)
+                data[row * strideY + col] = (uint8_t)(16 + (row + col) % 220);
+        frame = {};
+        frame.data = data.data();
+        frame.width = width;
+        frame.height = height;
+        frame.count = 3;
+        frame.offset[0] = 0;
+        frame.offset[1] = sizeY;
+        frame.offset[2] = sizeY + sizeUV;
+        frame.stride[0] = strideY;
+        frame.stride[1] = strideUV;
+        frame.stride[2] = strideUV;
+    }
+
+    uint64_t imageBytes() const { return (uint64_t)frame.width * frame.height * 3 / 2; }
+};
+
+static int scaledSize(int size)
+{
+    return std::max(2, size / 2 & ~1);
+}
+
+static void benchCopyAndCentreYuv(BenchState &state, const BenchResolution &res, bool padded)
+{
+    SyntheticFrame source(res.width, res.height, padded);
+    int stride = source.frame.stride[0];
+    std::vector<uint8_t> dest(stride * res.height * 3 / 2);
+    uint8_t *y = dest.data();
+    uint8_t *u = y + stride * res.height;
+    uint8_t *v = u + stride / 2 * res.height / 2;
+    while (state.keepRunning())
+    {
+        copyAndCentreYuv(source.frame.buffer(IVideoFrame::Y_PLANE), source.frame.buffer(IVideoFrame::U_PLANE),
+                         source.frame.buffer(IVideoFrame::V_PLANE), res.width, res.height, stride, y, u, v, stride);
+    }
+    state.setBytesProcessed(state.iterations() * source.imageBytes());
+}
+
+static void benchCopyFrame(BenchState &state, const BenchResolution &res, bool padded, bool scale)
+{
+    SyntheticFrame source(res.width, res.height, padded);
+    FrameScaleState scaleState;
+    // 与 deliverFrame_I420 一致：设置了目标尺寸时行宽即为目标宽度，否则沿用源帧 stride
+    int width = scale ? scaledSize(res.width) : res.width;
+    int height = scale ? scaledSize(res.height) : res.height;
+    int stride = scale ? width : (int)source.frame.stride[0];
+    std::vector<uint8_t> dest(stride * height * 3 / 2);
+    uint8_t *y = dest.data();
+    uint8_t *u = y + stride * height;
+    uint8_t *v = u + stride / 2 * (height / 2);
+    while (state.keepRunning())
+    {
+        copyI420Frame(source.frame, scaleState, SCALE_FILTER_DEFAULT_BUDGET_US, stride, source.frame.stride[0], width, height, y, u, v);
+    }
+    state.setBytesProcessed(state.iterations() * source.imageBytes());
+}
+
+// 固定滤波档位，测量 copyI420Frame 从源分辨率缩放到目标分辨率的耗时
+static void benchScaleFilter(BenchState &state, const BenchScale &scale, NodeVideoScaleFilter filter)
+{
+    SyntheticFrame source(scale.source.width, scale.source.height, false);
+    FrameScaleState scaleState;
+    scaleState.mode = filter;
+    int width = scale.target.width;
+    int height = scale.target.height;
+    std::vector<uint8_t> dest(width * height * 3 / 2);
+    uint8_t *y = dest.data();
+    uint8_t *u = y + width * height;
+    uint8_t *v = u + width / 2 * (height / 2);
+    while (state.keepRunning())
+    {
+        copyI420Frame(source.frame, scaleState, SCALE_FILTER_DEFAULT_BUDGET_US, width, width, width, height, y, u, v);
+    }
+    state.setBytesProcessed(state.iterations() * source.imageBytes());
+}
+
+static void benchDeliverFrame(BenchState &state, Isolate *isolate, const BenchResolution &res, bool padded, bool scale, int streams)
+{
+    NodeVideoFrameTransporter transporter;
+    transporter.initializeManualDrain(isolate);
+    SyntheticFrame source(res.width, res.height, padded);
+    std::vector<NodeVideoCanvasContext *> contexts;
+    for (int i = 0; i < streams; i++)
+    {
+        nertc::uid_t uid = 1001 + i;
+        contexts.push_back(transporter.getVideoCanvasContext(NODE_RENDER_TYPE_REMOTE, uid, ""));
+        if (scale)
+            transporter.setVideoDimension(NODE_RENDER_TYPE_REMOTE, uid, "", scaledSize(res.width), scaledSize(res.height));
+    }
+    while (state.keepRunning())
+    {
+        for (NodeVideoCanvasContext *context : contexts)
+            transporter.deliverFrame_I420(*context, source.frame, 0, false);
+    }
+    state.setItemsProcessed(state.iterations() * streams);
+    state.setBytesProcessed(state.iterations() * streams * source.imageBytes());
+}
+
+// 每个线程投递一路流，多个线程同时竞争传输器的内部锁，计时为全部线程完成的墙钟时间
+static void benchDeliverFrameThreads(BenchState &state, Isolate *isolate, const BenchResolution &res, int threads)
+{
+    NodeVideoFrameTransporter transporter;
+    transporter.initializeManualDrain(isolate);
+    SyntheticFrame source(res.width, res.height, false);
+    std::vector<NodeVideoCanvasContext *> contexts;
+    for (int i = 0; i < threads; i++)
+        contexts.push_back(transporter.getVideoCanvasContext(NODE_RENDER_TYPE_REMOTE, 1001 + i, ""));
+    uint64_t iterations = state.iterations();
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (NodeVideoCanvasContext *context : contexts)
+    {
+        workers.emplace_back([&transporter, &source, context, iterations]() {
+            for (uint64_t i = 0; i < iterations; i++)
+                transporter.deliverFrame_I420(*context, source.frame, 0, false);
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+    state.setManualTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+    state.setItemsProcessed(iterations * threads);
+    state.setBytesProcessed(iterations * threads * source.imageBytes());
+}
+
+static void emptyCallback(const FunctionCallbackInfo<Value> &args)
+{
+}
+
+// 每次迭代把所有流标记为有新帧，测量 drain 组装 JS 对象并回调的开销；帧数据以外部 ArrayBuffer 交给 JS，不计字节
+static void benchDrain(BenchState &state, Isolate *isolate, const BenchResolution &res, int streams)
+{
+    NodeVideoFrameTransporter transporter;
+    transporter.initializeManualDrain(isolate);
+    SyntheticFrame source(res.width, res.height, false);
+    std::vector<NodeVideoCanvasContext *> contexts;
+    for (int i = 0; i < streams; i++)
+    {
+        contexts.push_back(transporter.getVideoCanvasContext(NODE_RENDER_TYPE_REMOTE, 1001 + i, ""));
+        transporter.deliverFrame_I420(*contexts.back(), source.frame, 0, false);
+    }
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Function> cb = Function::New(context, emptyCallback).ToLocalChecked();
+    Local<Value> recv = v8::Undefined(isolate);
+    while (state.keepRunning())
+    {
+        HandleScope scope(isolate);
+        for (NodeVideoCanvasContext *canvas : contexts)
+            canvas->info->m_needUpdate = true;
+        transporter.drainVideoFrames(isolate, cb, recv);
+    }
+    state.setItemsProcessed(state.iterations() * streams);
+}
+
+static void registerCases(Isolate *isolate, std::vector<BenchCase> &cases)
+{
+    for (const BenchResolution &res : kResolutions)
+    {
+        for (bool padded : {false, true})
+        {
+            std::string name = std::string("BM_copyAndCentreYuv/") + res.name + (padded ? "/stride" : "/nostride");
+            cases.push_back({name, [res, padded](BenchState &state) { benchCopyAndCentreYuv(state, res, padded); }});
+        }
+    }
+    for (const BenchResolution &res : kResolutions)
+    {
+        for (bool padded : {false, true})
+        {
+            for (bool scale : {false, true})
+            {
+                std::string name = std::string("BM_copyFrame/") + res.name + (padded ? "/stride" : "/nostride") + (scale ? "/scale" : "/noscale");
+                cases.push_back({name, [res, padded, scale](BenchState &state) { benchCopyFrame(state, res, padded, scale); }});
+            }
+        }
+    }
+    for (const BenchScale &scale : kScaleCases)
+    {
+        for (int filter = NODE_VIDEO_SCALE_FILTER_NONE; filter <= NODE_VIDEO_SCALE_FILTER_BOX; filter++)
+        {
+            std::string name = std::string("BM_copyFrame/") + scale.source.name + "/scale/" + scale.target.name + "/" + kScaleFilterNames[filter];
+            cases.push_back({name, [scale, filter](BenchState &state) { benchScaleFilter(state, scale, (NodeVideoScaleFilter)filter); }});
+        }
+    }
+    for (const BenchResolution &res : kResolutions)
+    {
+        for (bool padded : {false, true})
+        {
+            for (bool scale : {false, true})
+            {
+                std::string name = std::string("BM_deliverFrame_I420/") + res.name + (padded ? "/stride" : "/nostride") + (scale ? "/scale" : "/noscale") + "/streams:1";
+                cases.push_back({name, [isolate, res, padded, scale](BenchState &state) { benchDeliverFrame(state, isolate, res, padded, scale, 1); }});
+            }
+        }
+    }
+    // 多路流只测到 1080p，32 路 4K 的缓冲超过 700MB
+    for (int index : {1, 2, 3})
+    {
+        const BenchResolution &res = kResolutions[index];
+        for (int streams : {4, 16, 32})
+        {
+            std::string name = std::string("BM_deliverFrame_I420/") + res.name + "/nostride/noscale/streams:" + std::to_string(streams);
+            cases.push_back({name, [isolate, res, streams](BenchState &state) { benchDeliverFrame(state, isolate, res, false, false, streams); }});
+        }
+    }
+    for (int threads : {2, 4, 8, 16})
+    {
+        const BenchResolution &res = kResolutions[2];
+        std::string name = std::string("BM_deliverFrame_I420/") + res.name + "/nostride/noscale/threads:" + std::to_string(threads);
+        cases.push_back({name, [isolate, res, threads](BenchState &state) { benchDeliverFrameThreads(state, isolate, res, threads); }});
+    }
+    for (int streams : {1, 4, 16, 32})
+    {
+        const BenchResolution &res = kResolutions[2];
+        std::string name = std::string("BM_FlushVideo_drain/") + res.name + "/streams:" + std::to_string(streams);
+        cases.push_back({name, [isolate, res, streams](BenchState &state) { benchDrain(state, isolate, res, streams); }});
+    }
+}
+
+// 迭代次数从 1 开始，按上一轮耗时估算达到最短时间所需的次数，每轮最多放大 10 倍
+static void runCase(const BenchCase &bench, double minTime, BenchState &result)
+{
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        BenchState state(iterations);
+        bench.fn(state);
+        if (state.seconds() >= minTime || iterations >= 1000000000)
+        {
+            result = state;
+            return;
+        }
+        double multiplier = state.seconds() > 0 ? minTime * 1.4 / state.seconds() : 10;
+        multiplier = std::min(10.0, std::max(multiplier, 1.0));
+        iterations = std::max(iterations + 1, (uint64_t)(iterations * multiplier));
+    }
+}
+
+// run([filter], [minTime])：filter 为正则表达式，只运行名称匹配的用例；minTime 为每个用例的最短计时（秒）
+static void Run(const FunctionCallbackInfo<Value> &args)
+{
+    Isolate *isolate = args.GetIsolate();
+    Local<Context> context = isolate->GetCurrentContext();
+    UTF8String filterArg;
+    std::string filter = ".*";
+    if (args.Length() > 0 && args[0]->IsString() && nim_napi_get_value_utf8string(isolate, args[0], filterArg) == napi_ok && filterArg.length() > 0)
+        filter = filterArg.toUtf8String();
+    double minTime = 0.2;
+    if (args.Length() > 1 && args[1]->IsNumber())
+        minTime = args[1].As<v8::Number>()->Value();
+
+    std::vector<BenchCase> cases;
+    registerCases(isolate, cases);
+    std::regex pattern(filter);
+    Local<Array> results = Array::New(isolate);
+    uint32_t index = 0;
+    for (const BenchCase &bench : cases)
+    {
+        if (!std::regex_search(bench.name, pattern))
+            continue;
+        BenchState state(0);
+        runCase(bench, minTime, state);
+        Local<Object> item = Object::New(isolate);
+        nim_napi_set_object_value_utf8string(isolate, item, "name", bench.name);
+        nim_napi_set_object_value_uint64(isolate, item, "iterations", state.iterations());
+        nim_napi_set_object_value_double(isolate, item, "ns_per_frame", state.seconds() * 1e9 / std::max<uint64_t>(state.items(), 1));
+        nim_napi_set_object_value_double(isolate, item, "gb_per_s", state.bytes() / std::max(state.seconds(), 1e-9) / 1e9);
+        results->Set(context, index++, item);
+    }
+    args.GetReturnValue().Set(results);
+}
+
+static void InitBench(Local<Object> exports, Local<Value> module, Local<Context> context)
+{
+    NODE_SET_METHOD(exports, "run", Run);
+}
+
+} // namespace nertc_node
+
+NODE_MODULE_CONTEXT_AWARE(nertc_transport_bench, nertc_node::InitBench)
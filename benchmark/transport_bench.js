@@ -0,0 +1,16 @@
+// 用法：node transport_bench.js [filter] [min_time]，filter 为用例名的正则表达式，min_time 为每个用例的最短计时（秒），例如
+// node transport_bench.js 'BM_deliverFrame_I420/720p' 0.5
+const path = require('path')
+const bench = require(path.resolve(__dirname, 'build/Release/nertc-transport-bench.node'))
+
+const filter = process.argv[2] || ''
+const minTime = Number(process.argv[3] || '0.2')
+console.log('Benchmark'.padEnd(56), 'ns/frame'.padStart(14), 'Iterations'.padStart(12), 'GB/s'.padStart(10))
+console.log('-'.repeat(95))
+bench.run(filter, minTime).forEach(({ name, iterations, ns_per_frame, gb_per_s }) => {
+  // drain 不搬运帧数据，不报告吞吐量
+  const throughput = gb_per_s > 0 ? gb_per_s.toFixed(2) : '-'
+  console.log(name.padEnd(56), ns_per_frame.toFixed(0).padStart(14), String(iterations).padStart(12), throughput.padStart(10))
+})
+// 插件加载时创建的 uv_async 句柄会使事件循环不退出
+process.exit(0)
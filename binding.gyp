@@ -20,8 +20,30 @@
         './nertc_sdk_node/nertc_node_ext.h',
         './nertc_sdk_node/nertc_node_video_frame_provider.cpp',
         './nertc_sdk_node/nertc_node_video_frame_provider.h',
+        './nertc_sdk_node/nertc_node_video_frame_copy.cpp',
+        './nertc_sdk_node/nertc_node_video_frame_copy.h',
+        './nertc_sdk_node/nertc_node_video_frame_sink.cpp',
+        './nertc_sdk_node/nertc_node_video_frame_sink.h',
+        './nertc_sdk_node/nertc_node_video_quality_probe.cpp',
+        './nertc_sdk_node/nertc_node_video_quality_probe.h',
+        './nertc_sdk_node/nertc_node_latency_histogram.cpp',
+        './nertc_sdk_node/nertc_node_latency_histogram.h',
+        './nertc_sdk_node/nertc_node_live_stream_cache.cpp',
+        './nertc_sdk_node/nertc_node_live_stream_cache.h',
+        './nertc_sdk_node/nertc_node_render_governor.cpp',
+        './nertc_sdk_node/nertc_node_render_governor.h',
+        './nertc_sdk_node/nertc_node_sei_queue.cpp',
+        './nertc_sdk_node/nertc_node_sei_queue.h',
+        './nertc_sdk_node/nertc_node_sei_sender.cpp',
+        './nertc_sdk_node/nertc_node_sei_sender.h',
+        './nertc_sdk_node/nertc_node_stats_snapshot.cpp',
+        './nertc_sdk_node/nertc_node_stats_snapshot.h',
+        './nertc_sdk_node/nertc_node_stats_template.cpp',
+        './nertc_sdk_node/nertc_node_stats_template.h',
         './shared/sdk_helper/nim_node_helper.h',
         './shared/sdk_helper/nim_node_helper.cpp',
+        './shared/sdk_helper/nim_node_key_cache.h',
+        './shared/sdk_helper/nim_node_key_cache.cpp',
         './shared/sdk_helper/nim_node_async_queue.h',
         './shared/sdk_helper/nim_node_async_queue.cpp',
         './shared/sdk_helper/nim_event_handler.h',
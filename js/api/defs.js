@@ -1,6 +1,6 @@
 "use strict";
 Object.defineProperty(exports, "__esModule", { value: true });
-exports.NERtcVoiceEqualizationBand = exports.NERtcVoiceBeautifierType = exports.NERtcVoiceChangerType = exports.NERtcMediaStatsEventName = exports.NERtcLiveStreamStateCode = exports.NERtcAudioMixingErrorCode = exports.NERtcAudioMixingState = exports.NERtcAudioDeviceState = exports.NERtcAudioDeviceType = exports.NERtcReasonConnectionChangedType = exports.NERtcConnectionStateType = exports.NERtcNetworkQualityType = exports.NERtcVideoStreamType = exports.NERtcAudioStreamType = exports.NERtcStreamChannelType = exports.NERtcClientRole = exports.NERtcVideoDeviceTransportType = exports.NERtcAudioDeviceTransportType = exports.NERtcLiveStreamAudioCodecProfile = exports.NERtcLiveStreamAudioSampleRate = exports.NERtcLiveStreamVideoScaleMode = exports.NERtcLiveStreamMode = exports.NERtcSubStreamContentPrefer = exports.NERtcScreenProfileType = exports.NERtcDegradationPreference = exports.NERtcVideoFramerateType = exports.NERtcVideoCropMode = exports.NERtcAudioScenarioType = exports.NERtcAudioProfileType = exports.NERtcVideoMirrorMode = exports.NERtcVideoScalingMode = exports.NERtcVideoProfileType = exports.NERtcSessionLeaveReason = exports.NERtcErrorCode = exports.NERtcRemoteVideoStreamType = exports.NERtcChannelProfileType = exports.NERtcLogLevel = void 0;
+exports.NERtcLiveStreamUserField = exports.NERtcStreamRenderPriority = exports.NERtcVideoScaleFilter = exports.NERtcVideoQualityReference = exports.NERtcVideoOutputFormat = exports.NERtcNetworkQualityColumn = exports.NERtcRemoteVideoStatsColumn = exports.NERtcRemoteAudioStatsColumn = exports.NERtcVideoDumpFormat = exports.NERtcVoiceEqualizationBand = exports.NERtcVoiceBeautifierType = exports.NERtcVoiceChangerType = exports.NERtcMediaStatsEventName = exports.NERtcLiveStreamStateCode = exports.NERtcAudioMixingErrorCode = exports.NERtcAudioMixingState = exports.NERtcAudioDeviceState = exports.NERtcAudioDeviceType = exports.NERtcReasonConnectionChangedType = exports.NERtcConnectionStateType = exports.NERtcNetworkQualityType = exports.NERtcVideoStreamType = exports.NERtcAudioStreamType = exports.NERtcStreamChannelType = exports.NERtcClientRole = exports.NERtcVideoDeviceTransportType = exports.NERtcAudioDeviceTransportType = exports.NERtcLiveStreamAudioCodecProfile = exports.NERtcLiveStreamAudioSampleRate = exports.NERtcLiveStreamVideoScaleMode = exports.NERtcLiveStreamMode = exports.NERtcSubStreamContentPrefer = exports.NERtcScreenProfileType = exports.NERtcDegradationPreference = exports.NERtcVideoFramerateType = exports.NERtcVideoCropMode = exports.NERtcAudioScenarioType = exports.NERtcAudioProfileType = exports.NERtcVideoMirrorMode = exports.NERtcVideoScalingMode = exports.NERtcVideoProfileType = exports.NERtcSessionLeaveReason = exports.NERtcErrorCode = exports.NERtcRemoteVideoStreamType = exports.NERtcChannelProfileType = exports.NERtcLogLevel = void 0;
 /** 日志级别。 */
 var NERtcLogLevel;
 (function (NERtcLogLevel) {
@@ -429,3 +429,89 @@ var NERtcVoiceEqualizationBand;
     NERtcVoiceEqualizationBand[NERtcVoiceEqualizationBand["kNERtcVoiceEqualizationBand_8K"] = 8] = "kNERtcVoiceEqualizationBand_8K";
     NERtcVoiceEqualizationBand[NERtcVoiceEqualizationBand["kNERtcVoiceEqualizationBand_16K"] = 9] = "kNERtcVoiceEqualizationBand_16K";
 })(NERtcVoiceEqualizationBand = exports.NERtcVoiceEqualizationBand || (exports.NERtcVoiceEqualizationBand = {}));
+/** 视频帧 dump 的文件格式 */
+var NERtcVideoDumpFormat;
+(function (NERtcVideoDumpFormat) {
+    NERtcVideoDumpFormat[NERtcVideoDumpFormat["kNERtcVideoDumpFormatI420"] = 0] = "kNERtcVideoDumpFormatI420";
+    NERtcVideoDumpFormat[NERtcVideoDumpFormat["kNERtcVideoDumpFormatY4M"] = 1] = "kNERtcVideoDumpFormatY4M";
+})(NERtcVideoDumpFormat = exports.NERtcVideoDumpFormat || (exports.NERtcVideoDumpFormat = {}));
+/** 远端音频统计快照的列序号，见 onRemoteAudioStatsSnapshot */
+var NERtcRemoteAudioStatsColumn;
+(function (NERtcRemoteAudioStatsColumn) {
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsUid"] = 0] = "kNERtcRemoteAudioStatsUid";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsReceivedBitrate"] = 1] = "kNERtcRemoteAudioStatsReceivedBitrate";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsTotalFrozenTime"] = 2] = "kNERtcRemoteAudioStatsTotalFrozenTime";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsFrozenRate"] = 3] = "kNERtcRemoteAudioStatsFrozenRate";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsAudioLossRate"] = 4] = "kNERtcRemoteAudioStatsAudioLossRate";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsVolume"] = 5] = "kNERtcRemoteAudioStatsVolume";
+    NERtcRemoteAudioStatsColumn[NERtcRemoteAudioStatsColumn["kNERtcRemoteAudioStatsColumnCount"] = 6] = "kNERtcRemoteAudioStatsColumnCount";
+})(NERtcRemoteAudioStatsColumn = exports.NERtcRemoteAudioStatsColumn || (exports.NERtcRemoteAudioStatsColumn = {}));
+/** 远端视频统计快照的列序号，每个视频流 layer 占一行，见 onRemoteVideoStatsSnapshot */
+var NERtcRemoteVideoStatsColumn;
+(function (NERtcRemoteVideoStatsColumn) {
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsUid"] = 0] = "kNERtcRemoteVideoStatsUid";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsLayerType"] = 1] = "kNERtcRemoteVideoStatsLayerType";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsWidth"] = 2] = "kNERtcRemoteVideoStatsWidth";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsHeight"] = 3] = "kNERtcRemoteVideoStatsHeight";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsReceivedBitrate"] = 4] = "kNERtcRemoteVideoStatsReceivedBitrate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsReceivedFrameRate"] = 5] = "kNERtcRemoteVideoStatsReceivedFrameRate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsDecoderFrameRate"] = 6] = "kNERtcRemoteVideoStatsDecoderFrameRate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsRenderFrameRate"] = 7] = "kNERtcRemoteVideoStatsRenderFrameRate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsPacketLossRate"] = 8] = "kNERtcRemoteVideoStatsPacketLossRate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsTotalFrozenTime"] = 9] = "kNERtcRemoteVideoStatsTotalFrozenTime";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsFrozenRate"] = 10] = "kNERtcRemoteVideoStatsFrozenRate";
+    NERtcRemoteVideoStatsColumn[NERtcRemoteVideoStatsColumn["kNERtcRemoteVideoStatsColumnCount"] = 11] = "kNERtcRemoteVideoStatsColumnCount";
+})(NERtcRemoteVideoStatsColumn = exports.NERtcRemoteVideoStatsColumn || (exports.NERtcRemoteVideoStatsColumn = {}));
+/** 网络质量快照的列序号，见 onNetworkQualitySnapshot */
+var NERtcNetworkQualityColumn;
+(function (NERtcNetworkQualityColumn) {
+    NERtcNetworkQualityColumn[NERtcNetworkQualityColumn["kNERtcNetworkQualityUid"] = 0] = "kNERtcNetworkQualityUid";
+    NERtcNetworkQualityColumn[NERtcNetworkQualityColumn["kNERtcNetworkQualityTx"] = 1] = "kNERtcNetworkQualityTx";
+    NERtcNetworkQualityColumn[NERtcNetworkQualityColumn["kNERtcNetworkQualityRx"] = 2] = "kNERtcNetworkQualityRx";
+    NERtcNetworkQualityColumn[NERtcNetworkQualityColumn["kNERtcNetworkQualityColumnCount"] = 3] = "kNERtcNetworkQualityColumnCount";
+})(NERtcNetworkQualityColumn = exports.NERtcNetworkQualityColumn || (exports.NERtcNetworkQualityColumn = {}));
+/** 投递给渲染器的视频帧格式 */
+var NERtcVideoOutputFormat;
+(function (NERtcVideoOutputFormat) {
+    NERtcVideoOutputFormat[NERtcVideoOutputFormat["kNERtcVideoOutputFormatI420"] = 0] = "kNERtcVideoOutputFormatI420";
+    NERtcVideoOutputFormat[NERtcVideoOutputFormat["kNERtcVideoOutputFormatRGBA"] = 1] = "kNERtcVideoOutputFormatRGBA";
+    NERtcVideoOutputFormat[NERtcVideoOutputFormat["kNERtcVideoOutputFormatBGRA"] = 2] = "kNERtcVideoOutputFormatBGRA";
+    NERtcVideoOutputFormat[NERtcVideoOutputFormat["kNERtcVideoOutputFormatNV12"] = 3] = "kNERtcVideoOutputFormatNV12";
+})(NERtcVideoOutputFormat = exports.NERtcVideoOutputFormat || (exports.NERtcVideoOutputFormat = {}));
+/** 质量探测的参考路径 */
+var NERtcVideoQualityReference;
+(function (NERtcVideoQualityReference) {
+    NERtcVideoQualityReference[NERtcVideoQualityReference["kNERtcVideoQualityReferenceSource"] = 0] = "kNERtcVideoQualityReferenceSource";
+    NERtcVideoQualityReference[NERtcVideoQualityReference["kNERtcVideoQualityReferenceBox"] = 1] = "kNERtcVideoQualityReferenceBox";
+})(NERtcVideoQualityReference = exports.NERtcVideoQualityReference || (exports.NERtcVideoQualityReference = {}));
+/** 渲染缩放的滤波档位 */
+var NERtcVideoScaleFilter;
+(function (NERtcVideoScaleFilter) {
+    NERtcVideoScaleFilter[NERtcVideoScaleFilter["kNERtcVideoScaleFilterNone"] = 0] = "kNERtcVideoScaleFilterNone";
+    NERtcVideoScaleFilter[NERtcVideoScaleFilter["kNERtcVideoScaleFilterLinear"] = 1] = "kNERtcVideoScaleFilterLinear";
+    NERtcVideoScaleFilter[NERtcVideoScaleFilter["kNERtcVideoScaleFilterBilinear"] = 2] = "kNERtcVideoScaleFilterBilinear";
+    NERtcVideoScaleFilter[NERtcVideoScaleFilter["kNERtcVideoScaleFilterBox"] = 3] = "kNERtcVideoScaleFilterBox";
+    NERtcVideoScaleFilter[NERtcVideoScaleFilter["kNERtcVideoScaleFilterAuto"] = 4] = "kNERtcVideoScaleFilterAuto";
+})(NERtcVideoScaleFilter = exports.NERtcVideoScaleFilter || (exports.NERtcVideoScaleFilter = {}));
+/** 视频流的渲染优先级 */
+var NERtcStreamRenderPriority;
+(function (NERtcStreamRenderPriority) {
+    NERtcStreamRenderPriority[NERtcStreamRenderPriority["kNERtcStreamRenderPriorityActiveSpeaker"] = 0] = "kNERtcStreamRenderPriorityActiveSpeaker";
+    NERtcStreamRenderPriority[NERtcStreamRenderPriority["kNERtcStreamRenderPriorityPinned"] = 1] = "kNERtcStreamRenderPriorityPinned";
+    NERtcStreamRenderPriority[NERtcStreamRenderPriority["kNERtcStreamRenderPriorityVisible"] = 2] = "kNERtcStreamRenderPriorityVisible";
+    NERtcStreamRenderPriority[NERtcStreamRenderPriority["kNERtcStreamRenderPriorityOffscreen"] = 3] = "kNERtcStreamRenderPriorityOffscreen";
+})(NERtcStreamRenderPriority = exports.NERtcStreamRenderPriority || (exports.NERtcStreamRenderPriority = {}));
+/** 直播成员布局二进制编码的字段序号，第 i 个成员的第 field 项位于 data[i * kNERtcLiveStreamUserFieldCount + field]，见 encodeLiveStreamUsers */
+var NERtcLiveStreamUserField;
+(function (NERtcLiveStreamUserField) {
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserUid"] = 0] = "kNERtcLiveStreamUserUid";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserVideoPush"] = 1] = "kNERtcLiveStreamUserVideoPush";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserAdaption"] = 2] = "kNERtcLiveStreamUserAdaption";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserX"] = 3] = "kNERtcLiveStreamUserX";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserY"] = 4] = "kNERtcLiveStreamUserY";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserWidth"] = 5] = "kNERtcLiveStreamUserWidth";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserHeight"] = 6] = "kNERtcLiveStreamUserHeight";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserAudioPush"] = 7] = "kNERtcLiveStreamUserAudioPush";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserZOrder"] = 8] = "kNERtcLiveStreamUserZOrder";
+    NERtcLiveStreamUserField[NERtcLiveStreamUserField["kNERtcLiveStreamUserFieldCount"] = 9] = "kNERtcLiveStreamUserFieldCount";
+})(NERtcLiveStreamUserField = exports.NERtcLiveStreamUserField || (exports.NERtcLiveStreamUserField = {}));
@@ -130,12 +130,16 @@ class Renderer {
         }
     }
     drawFrame(imageData = { header, yUint8Array, uUint8Array, vUint8Array }) {
+        if (imageData.dirtyTiles) {
+            // 不支持只包含变化块的帧，脏块投递请使用 GlRenderer
+            return;
+        }
         if (!this.ready) {
             this.ready = true;
             this.event.emit('ready');
         }
         let dv = new DataView(imageData.header);
-        // let format = dv.getUint8(0);
+        let pixelFormat = dv.getUint8(0);
         let mirror = dv.getUint8(1);
         let contentWidth = dv.getUint16(2);
         let contentHeight = dv.getUint16(4);
@@ -154,6 +158,16 @@ class Renderer {
             clientWidth: this.container.clientWidth,
             clientHeight: this.container.clientHeight,
         });
+        if (pixelFormat === 1) {
+            // native 层已转换为 RGBA，直接绘制，跳过 JS 中的颜色转换
+            let rgba = imageData.yUint8Array;
+            let pixels = new Uint8ClampedArray(rgba.buffer, rgba.byteOffset, width * height * 4);
+            this.canvas.getContext('2d').putImageData(new ImageData(pixels, width, height), 0, 0);
+            return;
+        }
+        if (pixelFormat !== 0) {
+            return;
+        }
         let format = YUVBuffer.format({
             width,
             height,
@@ -1,6 +1,7 @@
 #include "nertc_node_engine.h"
 #include "nertc_node_engine_helper.h"
 #include "nertc_node_video_frame_provider.h"
+#include "nertc_node_stats_template.h"
 #ifdef WIN32
 #include "../shared/util/string_util.h"
 using namespace nertc_electron_util;
@@ -22,6 +23,7 @@ NertcNodeEngine::NertcNodeEngine(Isolate *isolate)
 }
 NertcNodeEngine::~NertcNodeEngine()
 {
+    sei_sender_.reset();
     if (rtc_engine_)
     {
         destroyNERtcEngine((void *&)rtc_engine_);
@@ -176,7 +178,37 @@ void NertcNodeEngine::InitModule(Local<Object> &exports,
     SET_PROTOTYPE(stopSystemAudioLoopbackCapture)
     SET_PROTOTYPE(setSystemAudioLoopbackCaptureVolume)
 
+    SET_PROTOTYPE(startVideoFrameDump)
+    SET_PROTOTYPE(stopVideoFrameDump)
+
+    SET_PROTOTYPE(enableSEIBatchDelivery)
+    SET_PROTOTYPE(setSEIMessageFilter)
+    SET_PROTOTYPE(enableVideoFrameSEIAttachment)
+    SET_PROTOTYPE(sendSEIMsgBatch)
+    SET_PROTOTYPE(setSEISendRate)
+    SET_PROTOTYPE(enableStatsSnapshot)
+    SET_PROTOTYPE(setVideoOutputFormat)
+    SET_PROTOTYPE(enableDuplicateFrameSuppression)
+    SET_PROTOTYPE(getDuplicateFrameStats)
+    SET_PROTOTYPE(enableDirtyTileDelivery)
+    SET_PROTOTYPE(enableVideoQualityProbe)
+    SET_PROTOTYPE(getVideoQualityProbeStats)
+    SET_PROTOTYPE(setVideoScaleFilter)
+    SET_PROTOTYPE(setVideoScaleCpuBudget)
+    SET_PROTOTYPE(enableVideoLatencyStats)
+    SET_PROTOTYPE(reportVideoFrameRendered)
+    SET_PROTOTYPE(getVideoLatencyStats)
+    SET_PROTOTYPE(getVideoTransportStats)
+    SET_PROTOTYPE(setStreamRenderPriority)
+    SET_PROTOTYPE(setVideoRenderBudget)
+    SET_PROTOTYPE(setStreamVisibility)
+    SET_PROTOTYPE(enableLazyStats)
+    SET_PROTOTYPE(updateLiveStreamUsers)
+
     END_OBJECT_INIT_EX(NertcNodeEngine)
+
+    nertc_init_stats_templates(isolate);
+    nertc_preload_property_keys(isolate);
 }
 
 void NertcNodeEngine::New(const FunctionCallbackInfo<Value> &args)
@@ -246,6 +278,8 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, release)
     do
     {
         CHECK_NATIVE_THIS(instance);
+        instance->sei_sender_.reset();
+        instance->live_stream_cache_.clear();
         instance->rtc_engine_->release(true);
         if (instance->rtc_engine_)
         {
@@ -254,6 +288,7 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, release)
             instance->_vdm = nullptr;
             instance->rtc_engine_ = nullptr;
         }
+        getNodeVideoFrameTransporter()->releaseVideoCanvasContexts();
         NertcNodeEventHandler::GetInstance()->RemoveAll();
         NertcNodeRtcMediaStatsHandler::GetInstance()->RemoveAll();
     } while (false);
@@ -296,6 +331,8 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, joinChannel)
             break;
         }
         ret = instance->rtc_engine_->joinChannel(token.length() == 0 ? "" : token.get(), channel_name.get(), uid);
+        if (ret == 0)
+            getNodeVideoFrameTransporter()->setChannelName(channel_name.toUtf8String());
     } while (false);
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
 }
@@ -308,6 +345,8 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, leaveChannel)
     {
         CHECK_NATIVE_THIS(instance);
         ret = instance->rtc_engine_->leaveChannel();
+        instance->live_stream_cache_.clear();
+        getNodeVideoFrameTransporter()->setChannelName("");
     } while (false);
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
 }
@@ -415,7 +454,8 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, setupVideoCanvas)
         }
         nertc::NERtcVideoCanvas canvas;
         canvas.cb = enable ? NodeVideoFrameTransporter::onFrameDataCallback : nullptr;
-        canvas.user_data = enable ? (void*)(new nertc::uid_t(uid)) : nullptr;
+        // 上下文按流复用，重复绑定不会再分配
+        canvas.user_data = enable ? getNodeVideoFrameTransporter()->getVideoCanvasContext(uid == 0 ? NODE_RENDER_TYPE_LOCAL : NODE_RENDER_TYPE_REMOTE, uid, "") : nullptr;
         canvas.window = nullptr;
         if (uid == 0)
             ret = instance->rtc_engine_->setupLocalVideoCanvas(&canvas);
@@ -1401,6 +1441,10 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, addLiveStreamTask)
             memset(info.extraInfo, 0, kNERtcMacSEIBufferLength);
             // info.config = {0};
             ret = instance->rtc_engine_->addLiveStreamTask(info);
+            if (ret == 0)
+            {
+                instance->live_stream_cache_.store(info);
+            }
             if (info.layout.users)
             {
                 delete[] info.layout.users;
@@ -1429,6 +1473,10 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, updateLiveStreamTask)
         if (status == napi_ok)
         {
             ret = instance->rtc_engine_->updateLiveStreamTask(info);
+            if (ret == 0)
+            {
+                instance->live_stream_cache_.store(info);
+            }
             if (info.layout.users)
             {
                 delete[] info.layout.users;
@@ -1459,6 +1507,10 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, removeLiveStreamTask)
             break;
         }
         ret = instance->rtc_engine_->removeLiveStreamTask(task_id.get());
+        if (ret == 0)
+        {
+            instance->live_stream_cache_.remove(task_id.toUtf8String());
+        }
     } while (false);
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
 }
@@ -1480,11 +1532,11 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateRecordDevices)
                 Local<Object> obj = Object::New(isolate);;
                 if (devices->getDeviceInfo(i, &info) == 0)
                 {
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_id"), nim_napi_new_utf8string(isolate, (char *)info.device_id));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_name"), nim_napi_new_utf8string(isolate, (char *)info.device_name));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_id"), nim_napi_new_utf8string(isolate, (char *)info.device_id));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_name"), nim_napi_new_utf8string(isolate, (char *)info.device_name));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
                     arr->Set(isolate->GetCurrentContext(), i, obj);
                 }
             }
@@ -1543,11 +1595,11 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumeratePlayoutDevices)
                 Local<Object> obj = Object::New(isolate);;
                 if (devices->getDeviceInfo(i, &info) == 0)
                 {
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_id"), nim_napi_new_utf8string(isolate, (char *)info.device_id));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_name"), nim_napi_new_utf8string(isolate, (char *)info.device_name));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_id"), nim_napi_new_utf8string(isolate, (char *)info.device_id));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_name"), nim_napi_new_utf8string(isolate, (char *)info.device_name));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
                     arr->Set(isolate->GetCurrentContext(), i, obj);
                 }
             }
@@ -1865,11 +1917,11 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateCaptureDevices)
                 if (devices->getDeviceInfo(i, &info) == 0)
                 {
                     Local<Object> obj = Object::New(isolate);
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_id"), nim_napi_new_utf8string(isolate, (const char*)info.device_id));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "device_name"), nim_napi_new_utf8string(isolate, (const char*)info.device_name));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
-                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_utf8string(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_id"), nim_napi_new_utf8string(isolate, (const char*)info.device_id));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "device_name"), nim_napi_new_utf8string(isolate, (const char*)info.device_name));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "transport_type"), nim_napi_new_uint32(isolate, info.transport_type));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "suspected_unavailable"), nim_napi_new_bool(isolate, info.suspected_unavailable));
+                    obj->Set(isolate->GetCurrentContext(),  nim_napi_new_key(isolate, "system_default_device"), nim_napi_new_bool(isolate, info.system_default_device));
                     arr->Set(isolate->GetCurrentContext(), i, obj);
                 }
             }
@@ -1948,7 +2000,7 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, setupSubStreamVideoCanvas)
         }
         nertc::NERtcVideoCanvas canvas;
         canvas.cb = enable ? NodeVideoFrameTransporter::onSubstreamFrameDataCallback : nullptr;
-        canvas.user_data = enable ? (void*)(new nertc::uid_t(uid)) : nullptr;
+        canvas.user_data = enable ? getNodeVideoFrameTransporter()->getVideoCanvasContext(uid == 0 ? NODE_RENDER_TYPE_LOCAL_SUBSTREAM : NODE_RENDER_TYPE_REMOTE_SUBSTREAM, uid, "") : nullptr;
         canvas.window = nullptr;
         if (uid == 0)
             ret = instance->rtc_engine_->setupLocalSubStreamVideoCanvas(&canvas);
@@ -2039,12 +2091,12 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, sendSEIMsg)
     do
     {
         CHECK_NATIVE_ADM_THIS(instance);
-        if (!args[0]->IsArrayBuffer())
+        const char* data = nullptr;
+        size_t length = 0;
+        std::string storage;
+        if (nim_napi_get_value_buffer(args[0], data, length, storage) != napi_ok)
             break;
-        auto buffer = args[0].As<ArrayBuffer>();
-        ret = instance->rtc_engine_->sendSEIMsg(
-            static_cast<const char*>(buffer->GetContents().Data()),
-            buffer->GetContents().ByteLength());
+        ret = instance->rtc_engine_->sendSEIMsg(data, (int)length);
     } while (false);
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
 }
@@ -2057,16 +2109,16 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, sendSEIMsgEx)
     {
         CHECK_NATIVE_ADM_THIS(instance);
         auto status = napi_ok;
-        if (!args[0]->IsArrayBuffer())
+        const char* data = nullptr;
+        size_t length = 0;
+        std::string storage;
+        if (nim_napi_get_value_buffer(args[0], data, length, storage) != napi_ok)
             break;
-        auto buffer = args[0].As<ArrayBuffer>();
 
         int32_t type;
         GET_ARGS_VALUE(isolate, 1, int32, type)
 
-        ret = instance->rtc_engine_->sendSEIMsg(
-            static_cast<const char*>(buffer->GetContents().Data()), 
-            buffer->GetContents().ByteLength(),
+        ret = instance->rtc_engine_->sendSEIMsg(data, (int)length,
             static_cast<nertc::NERtcStreamChannelType>(type));
     } while (false);
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
@@ -2105,10 +2157,10 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, pullExternalAudioFrame)
         auto status = napi_ok;
         int length = 0;
         GET_ARGS_VALUE(isolate, 0, int32, length)
-        if (status != napi_ok)
+        if (status != napi_ok || length <= 0)
             break;
         ASSEMBLE_BASE_CALLBACK(1);
-        auto shared_data = std::make_shared<unsigned char>(length);
+        std::shared_ptr<unsigned char> shared_data(new unsigned char[length], std::default_delete<unsigned char[]>());
         ret = instance->rtc_engine_->pullExternalAudioFrame(shared_data.get(), length);
         NertcNodeEventHandler::GetInstance()->onPullExternalAudioFrame(bcb, shared_data, length);
     } while (false);
@@ -2398,9 +2450,9 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateScreenCaptureSourceInfo)
                     nim_napi_set_object_value_int32(isolate, thumb, "height", thumbHeight);
                     Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, data, size);
                     Local<v8::Uint8Array> dataarray = v8::Uint8Array::New(buff, 0, size);
-                    Local<Value> propName = String::NewFromUtf8(isolate, "buffer", NewStringType::kInternalized).ToLocalChecked();
+                    Local<Value> propName = nim_napi_new_key(isolate, "buffer");
                     thumb->Set(isolate->GetCurrentContext(), propName, dataarray);
-                    Local<Value> thumbKey = String::NewFromUtf8(isolate, "thumbBGRA", NewStringType::kInternalized).ToLocalChecked();
+                    Local<Value> thumbKey = nim_napi_new_key(isolate, "thumbBGRA");
                     obj->Set(isolate->GetCurrentContext(), thumbKey, thumb);
                 }
                 arr->Set(isolate->GetCurrentContext(), i++, obj);
@@ -2428,9 +2480,9 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateScreenCaptureSourceInfo)
                     nim_napi_set_object_value_int32(isolate, thumb, "height", thumbHeight);
                     Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, data, size);
                     Local<v8::Uint8Array> dataarray = v8::Uint8Array::New(buff, 0, size);
-                    Local<Value> propName = String::NewFromUtf8(isolate, "buffer", NewStringType::kInternalized).ToLocalChecked();
+                    Local<Value> propName = nim_napi_new_key(isolate, "buffer");
                     thumb->Set(isolate->GetCurrentContext(), propName, dataarray);
-                    Local<Value> thumbKey = String::NewFromUtf8(isolate, "thumbBGRA", NewStringType::kInternalized).ToLocalChecked();
+                    Local<Value> thumbKey = nim_napi_new_key(isolate, "thumbBGRA");
                     obj->Set(isolate->GetCurrentContext(), thumbKey, thumb);
                 } else {
                     int iconSize = 0;
@@ -2446,9 +2498,9 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateScreenCaptureSourceInfo)
                         nim_napi_set_object_value_int32(isolate, icon, "height", thumbHeight);
                         Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, data, iconSize);
                         Local<v8::Uint8Array> dataarray = v8::Uint8Array::New(buff, 0, iconSize);
-                        Local<Value> propName = String::NewFromUtf8(isolate, "buffer", NewStringType::kInternalized).ToLocalChecked();
+                        Local<Value> propName = nim_napi_new_key(isolate, "buffer");
                         icon->Set(isolate->GetCurrentContext(), propName, dataarray);
-                        Local<Value> thumbKey = String::NewFromUtf8(isolate, "thumbBGRA", NewStringType::kInternalized).ToLocalChecked();
+                        Local<Value> thumbKey = nim_napi_new_key(isolate, "thumbBGRA");
                         obj->Set(isolate->GetCurrentContext(), thumbKey, icon);
                     }
                 }
@@ -2466,9 +2518,9 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, enumerateScreenCaptureSourceInfo)
                 nim_napi_set_object_value_int32(isolate, icon, "height", iconHeight);
                 Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, data, iconSize);
                 Local<v8::Uint8Array> dataarray = v8::Uint8Array::New(buff, 0, iconSize);
-                Local<Value> propName = String::NewFromUtf8(isolate, "buffer", NewStringType::kInternalized).ToLocalChecked();
+                Local<Value> propName = nim_napi_new_key(isolate, "buffer");
                 icon->Set(isolate->GetCurrentContext(), propName, dataarray);
-                Local<Value> thumbKey = String::NewFromUtf8(isolate, "iconBGRA", NewStringType::kInternalized).ToLocalChecked();
+                Local<Value> thumbKey = nim_napi_new_key(isolate, "iconBGRA");
                 obj->Set(isolate->GetCurrentContext(), thumbKey, icon);
             }
             arr->Set(isolate->GetCurrentContext(), i++, obj);
@@ -2527,4 +2579,718 @@ NIM_SDK_NODE_API_DEF(NertcNodeEngine, setSystemAudioLoopbackCaptureVolume)
     args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
 }
 
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, startVideoFrameDump)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 4)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, format;
+        UTF8String path;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, utf8string, path)
+        GET_ARGS_VALUE(isolate, 3, uint32, format)
+        if (status != napi_ok || path.length() == 0)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->startVideoFrameDump(getNodeRenderType(uid, streamType), uid, path.toUtf8String(),
+                format == NODE_VIDEO_SINK_FORMAT_Y4M ? NODE_VIDEO_SINK_FORMAT_Y4M : NODE_VIDEO_SINK_FORMAT_I420);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, stopVideoFrameDump)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->stopVideoFrameDump(getNodeRenderType(uid, streamType), uid);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableSEIBatchDelivery)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, bool, enable)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NertcNodeEventHandler::GetInstance()->GetSEIMessageQueue().setBatchDelivery(enable);
+        ret = 0;
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setSEIMessageFilter)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        std::vector<nertc::uid_t> uids;
+        if (args[0]->IsArray())
+        {
+            auto arr = args[0].As<Array>();
+            for (uint32_t i = 0; i < arr->Length(); i++)
+            {
+                uint64_t uid = 0;
+                status = nim_napi_get_value_uint64(isolate, arr->Get(isolate->GetCurrentContext(), i).ToLocalChecked(), uid);
+                if (status != napi_ok)
+                    break;
+                uids.push_back(uid);
+            }
+        }
+        else if (!args[0]->IsNullOrUndefined())
+        {
+            status = napi_invalid_arg;
+        }
+        if (status != napi_ok)
+        {
+            break;
+        }
+        std::string prefix;
+        if (!args[1]->IsNullOrUndefined())
+        {
+            const char* data = nullptr;
+            size_t length = 0;
+            std::string storage;
+            if (nim_napi_get_value_buffer(args[1], data, length, storage) != napi_ok)
+                break;
+            prefix.assign(data, length);
+        }
+        NertcNodeEventHandler::GetInstance()->GetSEIMessageQueue().setFilter(uids, prefix);
+        ret = 0;
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableVideoFrameSEIAttachment)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, bool, enable)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->setAttachSEIToFrame(enable);
+            ret = 0;
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, sendSEIMsgBatch)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    int ret = -1;
+    do
+    {
+        CHECK_NATIVE_THIS(instance);
+        auto status = napi_ok;
+        if (!args[0]->IsArray())
+            break;
+        int32_t type;
+        GET_ARGS_VALUE(isolate, 1, int32, type)
+        auto arr = args[0].As<Array>();
+        std::vector<std::pair<const char*, size_t>> messages;
+        // 预先分配，拷贝出的小消息在 enqueue 之前地址不变
+        std::vector<std::string> storage(arr->Length());
+        for (uint32_t i = 0; i < arr->Length(); i++)
+        {
+            const char* data = nullptr;
+            size_t length = 0;
+            status = nim_napi_get_value_buffer(arr->Get(isolate->GetCurrentContext(), i).ToLocalChecked(), data, length, storage[i]);
+            if (status != napi_ok || length == 0 || length > kNERtcMacSEIBufferLength)
+            {
+                status = napi_invalid_arg;
+                break;
+            }
+            messages.push_back(std::make_pair(data, length));
+        }
+        if (status != napi_ok)
+        {
+            break;
+        }
+        if (!instance->sei_sender_)
+        {
+            instance->sei_sender_.reset(new NodeSEISender(instance->rtc_engine_));
+        }
+        ret = instance->sei_sender_->enqueue(messages, static_cast<nertc::NERtcStreamChannelType>(type));
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setSEISendRate)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        CHECK_NATIVE_THIS(instance);
+        auto status = napi_ok;
+        uint32_t rate;
+        GET_ARGS_VALUE(isolate, 0, uint32, rate)
+        if (status != napi_ok || rate == 0)
+        {
+            break;
+        }
+        if (!instance->sei_sender_)
+        {
+            instance->sei_sender_.reset(new NodeSEISender(instance->rtc_engine_));
+        }
+        instance->sei_sender_->setRate(rate);
+        ret = 0;
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableStatsSnapshot)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, bool, enable)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NertcNodeRtcMediaStatsHandler::GetInstance()->GetStatsSnapshot()->setEnabled(enable);
+        ret = 0;
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setVideoOutputFormat)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 3)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, format;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, uint32, format)
+        if (status != napi_ok || format > NODE_VIDEO_OUTPUT_FORMAT_NV12)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setVideoOutputFormat(getNodeRenderType(uid, streamType), uid, (NodeVideoOutputFormat)format);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableDuplicateFrameSuppression)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 5)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, sampleStep, refreshInterval;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, bool, enable)
+        GET_ARGS_VALUE(isolate, 3, uint32, sampleStep)
+        GET_ARGS_VALUE(isolate, 4, uint32, refreshInterval)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setDuplicateFrameSuppression(getNodeRenderType(uid, streamType), uid, enable, sampleStep, refreshInterval);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, getDuplicateFrameStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    Local<Object> obj = Object::New(isolate);
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        uint64_t checkedFrames = 0, skippedFrames = 0;
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->getDuplicateFrameStats(getNodeRenderType(uid, streamType), uid, checkedFrames, skippedFrames);
+        }
+        nim_napi_set_object_value_uint64(isolate, obj, "checked_frames", checkedFrames);
+        nim_napi_set_object_value_uint64(isolate, obj, "skipped_frames", skippedFrames);
+    } while (false);
+    args.GetReturnValue().Set(obj);
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableDirtyTileDelivery)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 5)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, tileSize, refreshInterval;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, bool, enable)
+        GET_ARGS_VALUE(isolate, 3, uint32, tileSize)
+        GET_ARGS_VALUE(isolate, 4, uint32, refreshInterval)
+        // 块大小需为 16 的倍数，保证色度块对齐
+        if (status != napi_ok || tileSize < 16 || tileSize > 256 || tileSize % 16 != 0)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setDirtyTileDelivery(getNodeRenderType(uid, streamType), uid, enable, tileSize, refreshInterval);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableVideoQualityProbe)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 5)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, interval, reference;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, bool, enable)
+        GET_ARGS_VALUE(isolate, 3, uint32, interval)
+        GET_ARGS_VALUE(isolate, 4, uint32, reference)
+        if (status != napi_ok || interval == 0 || reference > NODE_QUALITY_REFERENCE_BOX)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setVideoQualityProbe(getNodeRenderType(uid, streamType), uid, enable, interval, (NodeQualityReference)reference);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, getVideoQualityProbeStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    Local<Object> obj = Object::New(isolate);
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeQualityProbeStats stats = NodeQualityProbeStats();
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->getVideoQualityProbeStats(getNodeRenderType(uid, streamType), uid, stats);
+        }
+        nim_napi_set_object_value_uint64(isolate, obj, "samples", stats.samples);
+        nim_napi_set_object_value_uint64(isolate, obj, "dropped", stats.dropped);
+        nim_napi_set_object_value_double(isolate, obj, "psnr", stats.psnr);
+        nim_napi_set_object_value_double(isolate, obj, "ssim", stats.ssim);
+        nim_napi_set_object_value_double(isolate, obj, "last_psnr", stats.lastPsnr);
+        nim_napi_set_object_value_double(isolate, obj, "last_ssim", stats.lastSsim);
+        nim_napi_set_object_value_double(isolate, obj, "min_psnr", stats.minPsnr);
+    } while (false);
+    args.GetReturnValue().Set(obj);
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setVideoScaleFilter)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 3)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, filter;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, uint32, filter)
+        if (status != napi_ok || filter > NODE_VIDEO_SCALE_FILTER_AUTO)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setVideoScaleFilter(getNodeRenderType(uid, streamType), uid, (NodeVideoScaleFilter)filter);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setVideoScaleCpuBudget)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint32_t budgetUs;
+        GET_ARGS_VALUE(isolate, 0, uint32, budgetUs)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->setVideoScaleBudget(budgetUs);
+            ret = 0;
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableVideoLatencyStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, bool, enable)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->setLatencyStats(enable);
+            ret = 0;
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, reportVideoFrameRendered)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 3)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, timestamp;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, uint32, timestamp)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->onVideoFrameRendered(getNodeRenderType(uid, streamType), uid, timestamp);
+            ret = 0;
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+static Local<Object> latencyHistogramToObject(Isolate *isolate, const NodeLatencyHistogram &histogram)
+{
+    Local<Object> obj = Object::New(isolate);
+    nim_napi_set_object_value_uint64(isolate, obj, "count", histogram.count());
+    nim_napi_set_object_value_double(isolate, obj, "mean", histogram.mean());
+    nim_napi_set_object_value_uint32(isolate, obj, "p50", histogram.percentile(0.5));
+    nim_napi_set_object_value_uint32(isolate, obj, "p90", histogram.percentile(0.9));
+    nim_napi_set_object_value_uint32(isolate, obj, "p99", histogram.percentile(0.99));
+    nim_napi_set_object_value_uint32(isolate, obj, "max", histogram.max());
+    return obj;
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, getVideoLatencyStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 2)
+    Local<Object> obj = Object::New(isolate);
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeLatencyHistogram arriveToDeliver, deliverToRender, arriveToRender;
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->getLatencyStats(getNodeRenderType(uid, streamType), uid, arriveToDeliver, deliverToRender, arriveToRender);
+        }
+        Local<Context> context = isolate->GetCurrentContext();
+        obj->Set(context, nim_napi_new_key(isolate, "arrive_to_deliver"), latencyHistogramToObject(isolate, arriveToDeliver));
+        obj->Set(context, nim_napi_new_key(isolate, "deliver_to_render"), latencyHistogramToObject(isolate, deliverToRender));
+        obj->Set(context, nim_napi_new_key(isolate, "arrive_to_render"), latencyHistogramToObject(isolate, arriveToRender));
+    } while (false);
+    args.GetReturnValue().Set(obj);
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, getVideoTransportStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 0)
+    Local<Array> arr = Array::New(isolate);
+    NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+    if (pTransporter)
+    {
+        uint32_t now = NodeVideoFrameTransporter::monotonicMs();
+        uint32_t index = 0;
+        pTransporter->forEachVideoFrameInfo([&](VideoFrameInfo &info) {
+            const FrameTransportStats &stats = info.m_stats;
+            bool substream = info.m_renderType == NODE_RENDER_TYPE_LOCAL_SUBSTREAM || info.m_renderType == NODE_RENDER_TYPE_REMOTE_SUBSTREAM;
+            size_t bufferBytes = info.m_buffer.capacity() + info.m_scaleBuffer.capacity() + info.m_tiles.previous.capacity() + info.m_tiles.packed.capacity();
+            Local<Object> obj = Object::New(isolate);
+            nim_napi_set_object_value_uint64(isolate, obj, "uid", info.m_uid);
+            nim_napi_set_object_value_uint32(isolate, obj, "stream_type", substream ? 1 : 0);
+            nim_napi_set_object_value_utf8string(isolate, obj, "channel_id", info.m_channelId);
+            nim_napi_set_object_value_uint64(isolate, obj, "received_frames", stats.receivedFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "suppressed_frames", stats.suppressedFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "copied_frames", stats.copiedFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "scaled_frames", stats.scaledFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "coalesced_frames", stats.coalescedFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "delivered_frames", stats.deliveredFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "throttled_frames", stats.throttledFrames);
+            nim_napi_set_object_value_uint64(isolate, obj, "hidden_frames", stats.hiddenFrames);
+            nim_napi_set_object_value_double(isolate, obj, "received_fps", stats.receivedRate.current(now));
+            nim_napi_set_object_value_double(isolate, obj, "delivered_fps", stats.deliveredRate.current(now));
+            nim_napi_set_object_value_uint64(isolate, obj, "copied_bytes", stats.copiedBytes);
+            nim_napi_set_object_value_double(isolate, obj, "copy_time_us", stats.copiedFrames ? (double)stats.copyTimeUs / stats.copiedFrames : 0);
+            nim_napi_set_object_value_uint64(isolate, obj, "buffer_bytes", bufferBytes);
+            arr->Set(isolate->GetCurrentContext(), index++, obj);
+        });
+    }
+    args.GetReturnValue().Set(arr);
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setStreamRenderPriority)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 3)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, priority;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, uint32, priority)
+        if (status != napi_ok || priority >= NODE_STREAM_PRIORITY_COUNT)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setStreamPriority(getNodeRenderType(uid, streamType), uid, (NodeStreamPriority)priority);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setVideoRenderBudget)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t pixelsPerSecond;
+        GET_ARGS_VALUE(isolate, 0, uint64, pixelsPerSecond)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            pTransporter->setRenderPixelBudget(pixelsPerSecond);
+            ret = 0;
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, setStreamVisibility)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 5)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        uint64_t uid;
+        uint32_t streamType, thumbnailInterval, thumbnailScale;
+        bool visible;
+        GET_ARGS_VALUE(isolate, 0, uint64, uid)
+        GET_ARGS_VALUE(isolate, 1, uint32, streamType)
+        GET_ARGS_VALUE(isolate, 2, bool, visible)
+        GET_ARGS_VALUE(isolate, 3, uint32, thumbnailInterval)
+        GET_ARGS_VALUE(isolate, 4, uint32, thumbnailScale)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+        if (pTransporter)
+        {
+            ret = pTransporter->setStreamVisibility(getNodeRenderType(uid, streamType), uid, visible, thumbnailInterval, thumbnailScale);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, enableLazyStats)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 1)
+    int ret = -1;
+    do
+    {
+        auto status = napi_ok;
+        bool enable;
+        GET_ARGS_VALUE(isolate, 0, bool, enable)
+        if (status != napi_ok)
+        {
+            break;
+        }
+        NertcNodeRtcMediaStatsHandler::GetInstance()->SetLazyStats(enable);
+        ret = 0;
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
+NIM_SDK_NODE_API_DEF(NertcNodeEngine, updateLiveStreamUsers)
+{
+    CHECK_API_FUNC(NertcNodeEngine, 3)
+    int ret = -1;
+    do
+    {
+        CHECK_NATIVE_THIS(instance);
+        auto status = napi_ok;
+        UTF8String task_id;
+        GET_ARGS_VALUE(isolate, 0, utf8string, task_id)
+        if (status != napi_ok || task_id.length() == 0 || !args[1]->IsFloat64Array() || !args[2]->IsArray())
+        {
+            break;
+        }
+        Local<v8::Float64Array> changes = args[1].As<v8::Float64Array>();
+        if (changes->Length() % NODE_LS_USER_FIELD_COUNT != 0)
+        {
+            break;
+        }
+        const double *rows = reinterpret_cast<const double *>(
+            static_cast<const uint8_t *>(nim_napi_get_arraybuffer_data(changes->Buffer())) + changes->ByteOffset());
+        Local<Array> removed = args[2].As<Array>();
+        std::vector<nertc::uid_t> removedUids;
+        removedUids.reserve(removed->Length());
+        for (uint32_t i = 0; i < removed->Length(); i++)
+        {
+            uint64_t uid = 0;
+            if (nim_napi_get_value_uint64(isolate, removed->Get(isolate->GetCurrentContext(), i).ToLocalChecked(), uid) != napi_ok)
+            {
+                status = napi_invalid_arg;
+                break;
+            }
+            removedUids.push_back(uid);
+        }
+        if (status != napi_ok)
+        {
+            break;
+        }
+        std::string taskId = task_id.toUtf8String();
+        const nertc::NERtcLiveStreamTaskInfo *info = instance->live_stream_cache_.applyUserChanges(
+            taskId, rows, changes->Length() / NODE_LS_USER_FIELD_COUNT, removedUids);
+        if (!info)
+        {
+            break;
+        }
+        ret = instance->rtc_engine_->updateLiveStreamTask(*info);
+        if (ret != 0)
+        {
+            instance->live_stream_cache_.rollback(taskId);
+        }
+    } while (false);
+    args.GetReturnValue().Set(Integer::New(args.GetIsolate(), ret));
+}
+
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <node_object_wrap.h>
 #include "../shared/sdk_helper/nim_node_helper.h"
 #include "nertc_node_engine_event_handler.h"
+#include "nertc_node_sei_sender.h"
+#include "nertc_node_live_stream_cache.h"
 #ifdef WIN32
 #include "../shared/util/windows_helper.h"
 #endif
@@ -164,6 +166,39 @@ public:
     NIM_SDK_NODE_API(stopSystemAudioLoopbackCapture);
     NIM_SDK_NODE_API(setSystemAudioLoopbackCaptureVolume);
 
+    // video frame dump
+    NIM_SDK_NODE_API(startVideoFrameDump);
+    NIM_SDK_NODE_API(stopVideoFrameDump);
+
+    // sei
+    NIM_SDK_NODE_API(enableSEIBatchDelivery);
+    NIM_SDK_NODE_API(setSEIMessageFilter);
+    NIM_SDK_NODE_API(enableVideoFrameSEIAttachment);
+    NIM_SDK_NODE_API(sendSEIMsgBatch);
+    NIM_SDK_NODE_API(setSEISendRate);
+
+    // stats
+    NIM_SDK_NODE_API(enableStatsSnapshot);
+
+    // video render
+    NIM_SDK_NODE_API(setVideoOutputFormat);
+    NIM_SDK_NODE_API(enableDuplicateFrameSuppression);
+    NIM_SDK_NODE_API(getDuplicateFrameStats);
+    NIM_SDK_NODE_API(enableDirtyTileDelivery);
+    NIM_SDK_NODE_API(enableVideoQualityProbe);
+    NIM_SDK_NODE_API(getVideoQualityProbeStats);
+    NIM_SDK_NODE_API(setVideoScaleFilter);
+    NIM_SDK_NODE_API(setVideoScaleCpuBudget);
+    NIM_SDK_NODE_API(enableVideoLatencyStats);
+    NIM_SDK_NODE_API(reportVideoFrameRendered);
+    NIM_SDK_NODE_API(getVideoLatencyStats);
+    NIM_SDK_NODE_API(getVideoTransportStats);
+    NIM_SDK_NODE_API(setStreamRenderPriority);
+    NIM_SDK_NODE_API(setVideoRenderBudget);
+    NIM_SDK_NODE_API(setStreamVisibility);
+    NIM_SDK_NODE_API(enableLazyStats);
+    NIM_SDK_NODE_API(updateLiveStreamUsers);
+
 protected:
     NertcNodeEngine(Isolate *isolate);
     ~NertcNodeEngine();
@@ -173,6 +208,8 @@ private:
     nertc::IRtcEngineEx *rtc_engine_ = nullptr;
     nertc::IAudioDeviceManager *_adm = nullptr;
     nertc::IVideoDeviceManager *_vdm = nullptr;
+    std::unique_ptr<NodeSEISender> sei_sender_;
+    NodeLiveStreamCache live_stream_cache_;
     Isolate *isolate_;
 #ifdef WIN32
     nertc_electron_util::WindowsHelpers *_windows_helper = nullptr;
@@ -1,6 +1,8 @@
 #include "nertc_node_engine_event_handler.h"
 #include "../shared/sdk_helper/nim_node_async_queue.h"
 #include "nertc_node_engine_helper.h"
+#include "nertc_node_stats_template.h"
+#include "nertc_node_video_frame_provider.h"
 
 namespace nertc_node
 {
@@ -354,6 +356,16 @@ void NertcNodeRtcMediaStatsHandler::onLocalAudioStats(const nertc::NERtcAudioSen
 
 void NertcNodeRtcMediaStatsHandler::onRemoteAudioStats(const nertc::NERtcAudioRecvStats *stats, unsigned int user_count)
 {
+    if (stats_snapshot_.enabled())
+    {
+        if (stats_snapshot_.writeRemoteAudio(stats, user_count))
+        {
+            nim_node::node_async_call::async_call([=]() {
+                NertcNodeRtcMediaStatsHandler::GetInstance()->Node_onStatsSnapshot(NODE_STATS_TABLE_REMOTE_AUDIO);
+            });
+        }
+        return;
+    }
     nertc::NERtcAudioRecvStats *ss = new nertc::NERtcAudioRecvStats[user_count];
     for (auto i = 0; i < user_count; i++) {
         ss[i] = stats[i];
@@ -378,6 +390,16 @@ void NertcNodeRtcMediaStatsHandler::onLocalVideoStats(const nertc::NERtcVideoSen
 
 void NertcNodeRtcMediaStatsHandler::onRemoteVideoStats(const nertc::NERtcVideoRecvStats *stats, unsigned int user_count)
 {
+    if (stats_snapshot_.enabled())
+    {
+        if (stats_snapshot_.writeRemoteVideo(stats, user_count))
+        {
+            nim_node::node_async_call::async_call([=]() {
+                NertcNodeRtcMediaStatsHandler::GetInstance()->Node_onStatsSnapshot(NODE_STATS_TABLE_REMOTE_VIDEO);
+            });
+        }
+        return;
+    }
     nertc::NERtcVideoRecvStats *ss = new nertc::NERtcVideoRecvStats[user_count];
     for (auto i = 0; i < user_count; i++) {
         ss[i].uid = stats[i].uid;
@@ -394,6 +416,16 @@ void NertcNodeRtcMediaStatsHandler::onRemoteVideoStats(const nertc::NERtcVideoRe
 
 void NertcNodeRtcMediaStatsHandler::onNetworkQuality(const nertc::NERtcNetworkQualityInfo *infos, unsigned int user_count)
 {
+    if (stats_snapshot_.enabled())
+    {
+        if (stats_snapshot_.writeNetworkQuality(infos, user_count))
+        {
+            nim_node::node_async_call::async_call([=]() {
+                NertcNodeRtcMediaStatsHandler::GetInstance()->Node_onStatsSnapshot(NODE_STATS_TABLE_NETWORK_QUALITY);
+            });
+        }
+        return;
+    }
     nertc::NERtcNetworkQualityInfo *ss = new nertc::NERtcNetworkQualityInfo[user_count];
     for (auto i = 0; i < user_count; i++) {
         ss[i] = infos[i];
@@ -408,8 +440,16 @@ void NertcNodeRtcMediaStatsHandler::Node_onRtcStats(const nertc::NERtcStats &sta
     Isolate *isolate = Isolate::GetCurrent();
     HandleScope scope(isolate);
     const unsigned argc = 1;
-    Local<Object> s = Object::New(isolate);
-    nertc_stats_to_obj(isolate, stats, s);
+    Local<Object> s;
+    if (lazy_stats_)
+    {
+        s = nertc_new_lazy_stats_obj(isolate, stats);
+    }
+    else
+    {
+        s = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_RTC);
+        nertc_stats_to_obj(isolate, stats, s);
+    }
     Local<Value> argv[argc] = { s };
     auto it = callbacks_.find("onRtcStats");
     if (it != callbacks_.end())
@@ -423,7 +463,7 @@ void NertcNodeRtcMediaStatsHandler::Node_onLocalAudioStats(const nertc::NERtcAud
     Isolate *isolate = Isolate::GetCurrent();
     HandleScope scope(isolate);
     const unsigned argc = 1;
-    Local<Object> s = Object::New(isolate);
+    Local<Object> s = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_AUDIO_SEND);
     nertc_audio_send_stats_to_obj(isolate, stats, s);
     Local<Value> argv[argc] = { s };
     auto it = callbacks_.find("onLocalAudioStats");
@@ -440,7 +480,7 @@ void NertcNodeRtcMediaStatsHandler::Node_onRemoteAudioStats(const nertc::NERtcAu
     Local<Array> s = Array::New(isolate);
     for (auto i = 0; i < (int)user_count; i++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_AUDIO_RECV);
         nertc_audio_recv_stats_to_obj(isolate, stats[i], o);
         s->Set(isolate->GetCurrentContext(), i, o);
     }
@@ -461,7 +501,7 @@ void NertcNodeRtcMediaStatsHandler::Node_onLocalVideoStats(const nertc::NERtcVid
     Isolate *isolate = Isolate::GetCurrent();
     HandleScope scope(isolate);
     const unsigned argc = 1;
-    Local<Object> s = Object::New(isolate);
+    Local<Object> s = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_VIDEO_SEND);
     nertc_video_send_stats_to_obj(isolate, stats, s);
     if (stats.video_layers_list)
     {
@@ -483,7 +523,7 @@ void NertcNodeRtcMediaStatsHandler::Node_onRemoteVideoStats(const nertc::NERtcVi
     Local<Array> s = Array::New(isolate);
     for (auto i = 0; i < (int)user_count; i++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_VIDEO_RECV);
         nertc_video_recv_stats_to_obj(isolate, stats[i], o);
         s->Set(isolate->GetCurrentContext(), i, o);
     }
@@ -514,7 +554,7 @@ void NertcNodeRtcMediaStatsHandler::Node_onNetworkQuality(const nertc::NERtcNetw
     Local<Array> s = Array::New(isolate);
     for (auto i = 0; i < (int)user_count; i++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_NETWORK_QUALITY);
         nertc_network_quality_to_obj(isolate, infos[i], o);
         s->Set(isolate->GetCurrentContext(), i, o);
     }
@@ -529,6 +569,30 @@ void NertcNodeRtcMediaStatsHandler::Node_onNetworkQuality(const nertc::NERtcNetw
     }
 }
 
+void NertcNodeRtcMediaStatsHandler::Node_onStatsSnapshot(NodeStatsTableType type)
+{
+    static const char* event_names[NODE_STATS_TABLE_COUNT] = {
+        "onRemoteAudioStatsSnapshot",
+        "onRemoteVideoStatsSnapshot",
+        "onNetworkQualitySnapshot",
+    };
+    Isolate *isolate = Isolate::GetCurrent();
+    HandleScope scope(isolate);
+    stats_snapshot_.drain(type, stats_table_);
+    auto it = callbacks_.find(event_names[type]);
+    if (it == callbacks_.end())
+        return;
+
+    // 整张表一次拷贝进 Float64Array，按列存放，列序号见 JS 侧的列枚举
+    const unsigned argc = 2;
+    size_t count = (size_t)stats_table_.rows * stats_table_.columns;
+    Local<ArrayBuffer> buffer = ArrayBuffer::New(isolate, count * sizeof(double));
+    if (count > 0)
+        memcpy(nim_napi_get_arraybuffer_data(buffer), stats_table_.data.data(), count * sizeof(double));
+    Local<Value> argv[argc] = { nim_napi_new_uint32(isolate, stats_table_.rows), v8::Float64Array::New(buffer, 0, count) };
+    it->second->callback_.Get(isolate)->Call(isolate->GetCurrentContext(), it->second->data_.Get(isolate), argc, argv);
+}
+
 void NertcNodeEventHandler::onUserSubStreamVideoStart(nertc::uid_t uid, nertc::NERtcVideoProfileType max_profile)
 {
     nim_node::node_async_call::async_call([=]() {
@@ -710,12 +774,20 @@ void NertcNodeEventHandler::onAudioHowling(bool howling)
 
 void NertcNodeEventHandler::onRecvSEIMsg(nertc::uid_t uid, const char* data, uint32_t dataSize)
 {
-    auto* copied = new char[dataSize];
-    memset(copied, 0, dataSize);
-    memcpy(copied, data, dataSize);
-	nim_node::node_async_call::async_call([=]() {
-		NertcNodeEventHandler::GetInstance()->Node_onRecvSEIMsg(uid, copied, dataSize);
-	});
+    // 消息先写入队列，同一时间最多只有一个待执行的投递任务
+    bool accepted = false;
+    if (sei_queue_.push(uid, data, dataSize, accepted))
+    {
+        nim_node::node_async_call::async_call([=]() {
+            NertcNodeEventHandler::GetInstance()->Node_onRecvSEIMsg();
+        });
+    }
+    // 挂到视频帧上的 SEI 与 onReceSEIMsg 使用同一组过滤条件
+    NodeVideoFrameTransporter *pTransporter = getNodeVideoFrameTransporter();
+    if (pTransporter && accepted)
+    {
+        pTransporter->onSEIMessage(uid, data, dataSize);
+    }
 }
 
 void NertcNodeEventHandler::onPullExternalAudioFrame(const BaseCallbackPtr& bcb, const std::shared_ptr<unsigned char>& data, uint32_t length)
@@ -975,7 +1047,7 @@ void NertcNodeEventHandler::Node_onRemoteAudioVolumeIndication(const nertc::NERt
     Local<Array> s = Array::New(isolate);
     for (auto i = 0; i < (int)speaker_number; i++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_AUDIO_VOLUME);
         nertc_audio_volume_info_to_obj(isolate, speakers[i], o);
         s->Set(isolate->GetCurrentContext(), i, o);
     }
@@ -1067,45 +1139,58 @@ void NertcNodeEventHandler::Node_onAudioHowling(bool howling)
 }
 
 
-void NertcNodeEventHandler::Node_onRecvSEIMsg(nertc::uid_t uid, const char* data, uint32_t length)
+void NertcNodeEventHandler::Node_onRecvSEIMsg()
 {
-	Isolate* isolate = Isolate::GetCurrent();
-	HandleScope scope(isolate);
-	const unsigned argc = 2;
+    Isolate* isolate = Isolate::GetCurrent();
+    HandleScope scope(isolate);
+    sei_queue_.drain(sei_batch_);
+    if (sei_batch_.entries.empty())
+        return;
 
-#if 0
-    std::unique_ptr<v8::BackingStore> backing = v8::ArrayBuffer::NewBackingStore(
-        (void*)data, length, [](void* data, size_t length, void* deleter_data) {
-            delete[] data;
-        }, nullptr);
+    auto it = callbacks_.find("onReceSEIMsgBatch");
+    if (sei_queue_.batchDelivery() && it != callbacks_.end())
+    {
+        // 所有消息合并为一个 ArrayBuffer，偏移表按 [uid, offset, length] 依次排列
+        const unsigned argc = 2;
+        size_t count = sei_batch_.entries.size();
+        Local<ArrayBuffer> buffer = ArrayBuffer::New(isolate, sei_batch_.payload.size());
+        if (!sei_batch_.payload.empty())
+            memcpy(nim_napi_get_arraybuffer_data(buffer), sei_batch_.payload.data(), sei_batch_.payload.size());
+        Local<ArrayBuffer> table_buffer = ArrayBuffer::New(isolate, count * 3 * sizeof(double));
+        double* table = static_cast<double*>(nim_napi_get_arraybuffer_data(table_buffer));
+        for (size_t i = 0; i < count; i++)
+        {
+            table[i * 3] = (double)sei_batch_.entries[i].uid;
+            table[i * 3 + 1] = sei_batch_.entries[i].offset;
+            table[i * 3 + 2] = sei_batch_.entries[i].length;
+        }
+        Local<Value> argv[argc] = { buffer, v8::Float64Array::New(table_buffer, 0, count * 3) };
+        it->second->callback_.Get(isolate)->Call(isolate->GetCurrentContext(), it->second->data_.Get(isolate), argc, argv);
+        return;
+    }
 
-    Local<v8::ArrayBuffer> message_buffer = ArrayBuffer::New(
-        isolate, 
-        std::move(backing)
-    );
-#else
-    Local<ArrayBuffer> buffer = ArrayBuffer::New(isolate, length);
-    memcpy(buffer->GetContents().Data(), data, length);
-    if (data)
+    it = callbacks_.find("onReceSEIMsg");
+    if (it == callbacks_.end())
+        return;
+    for (auto& entry : sei_batch_.entries)
     {
-        delete[] data;
-        data = nullptr;
+        const unsigned argc = 2;
+        Local<ArrayBuffer> buffer = ArrayBuffer::New(isolate, entry.length);
+        if (entry.length > 0)
+            memcpy(nim_napi_get_arraybuffer_data(buffer), sei_batch_.payload.data() + entry.offset, entry.length);
+        Local<Value> argv[argc] = { nim_napi_new_uint64(isolate, entry.uid), buffer };
+        it->second->callback_.Get(isolate)->Call(isolate->GetCurrentContext(), it->second->data_.Get(isolate), argc, argv);
     }
-#endif
-    
-	Local<Value> argv[argc] = { nim_napi_new_uint64(isolate, uid), buffer };
-	auto it = callbacks_.find("onReceSEIMsg");
-	if (it != callbacks_.end())
-	{
-		it->second->callback_.Get(isolate)->Call(isolate->GetCurrentContext(), it->second->data_.Get(isolate), argc, argv);
-	}
 }
 
 void NertcNodeEventHandler::Node_onPullExternalAudioFrame(const BaseCallbackPtr& bcb, const std::shared_ptr<unsigned char>& data, uint32_t length)
 {
     Isolate* isolate = Isolate::GetCurrent();
+    HandleScope scope(isolate);
     const unsigned argc = 1;
-    Local<v8::ArrayBuffer> buffer = ArrayBuffer::New(isolate, data.get(), length);
+    // data 在回调返回后即释放，拷贝一份交给 JS
+    Local<v8::ArrayBuffer> buffer = ArrayBuffer::New(isolate, length);
+    memcpy(nim_napi_get_arraybuffer_data(buffer), data.get(), length);
     Local<Value> argv[argc] = { buffer };
     bcb->callback_.Get(isolate)->Call(isolate->GetCurrentContext(),
         bcb->data_.Get(isolate), argc, argv);
@@ -6,6 +6,8 @@
 #include "../shared/sdk_helper/nim_event_handler.h"
 #include "nertc_engine_event_handler_ex.h"
 #include "nertc_engine_media_stats_observer.h"
+#include "nertc_node_sei_queue.h"
+#include "nertc_node_stats_snapshot.h"
 using v8::Object;
 
 namespace nertc_node
@@ -395,6 +397,7 @@ public:
 
 public:
     void onPullExternalAudioFrame(const BaseCallbackPtr& bcb, const std::shared_ptr<unsigned char>& data, uint32_t length);
+    NodeSEIMessageQueue& GetSEIMessageQueue() { return sei_queue_; }
 
 private:
     void Node_onError(int error_code, const utf8_string& msg);
@@ -450,9 +453,13 @@ private:
     void Node_onRemoveLiveStreamTask(const utf8_string& task_id, int error_code);
     void Node_onLiveStreamState(const utf8_string& task_id, const utf8_string& url, nertc::NERtcLiveStreamStateCode state); 
     void Node_onAudioHowling(bool howling);
-    void Node_onRecvSEIMsg(nertc::uid_t uid, const char* data, uint32_t dataSize);
+    void Node_onRecvSEIMsg();
     void Node_onPullExternalAudioFrame(const BaseCallbackPtr& bcb, const std::shared_ptr<unsigned char>& data, uint32_t length);
     void Node_onCheckNECastAudioDriverResult(nertc::NERtcInstallCastAudioDriverResult result);
+
+private:
+    NodeSEIMessageQueue sei_queue_;
+    SEIMessageBatch sei_batch_;
 };
 
 class NertcNodeRtcMediaStatsHandler : public nim_node::EventHandler, public nertc::IRtcMediaStatsObserver
@@ -460,7 +467,7 @@ class NertcNodeRtcMediaStatsHandler : public nim_node::EventHandler, public nert
 private:
     /* data */
 public:
-    NertcNodeRtcMediaStatsHandler(){};
+    NertcNodeRtcMediaStatsHandler() : lazy_stats_(false){};
     ~NertcNodeRtcMediaStatsHandler(){};
     SINGLETON_DEFINE(NertcNodeRtcMediaStatsHandler);
 
@@ -516,6 +523,10 @@ public:
      */
     virtual void onNetworkQuality(const nertc::NERtcNetworkQualityInfo *infos, unsigned int user_count);
 
+    NodeStatsSnapshot* GetStatsSnapshot() { return &stats_snapshot_; }
+    // 开启后 onRtcStats 回调按需取值的统计对象，只在 JS 线程读写
+    void SetLazyStats(bool enable) { lazy_stats_ = enable; }
+
 private:
     void Node_onRtcStats(const nertc::NERtcStats &stats);
     void Node_onLocalAudioStats(const nertc::NERtcAudioSendStats &stats);
@@ -523,6 +534,12 @@ private:
     void Node_onLocalVideoStats(const nertc::NERtcVideoSendStats &stats);
     void Node_onRemoteVideoStats(const nertc::NERtcVideoRecvStats *stats, unsigned int user_count);
     void Node_onNetworkQuality(const nertc::NERtcNetworkQualityInfo *infos, unsigned int user_count);
+    void Node_onStatsSnapshot(NodeStatsTableType type);
+
+private:
+    NodeStatsSnapshot stats_snapshot_;
+    NodeStatsTable stats_table_;
+    bool lazy_stats_;
 }; 
 
 }
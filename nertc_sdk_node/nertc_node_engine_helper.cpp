@@ -1,5 +1,7 @@
 #include "nertc_node_engine_helper.h"
+#include "nertc_node_stats_template.h"
 #include "../shared/sdk_helper/nim_node_helper.h"
+#include <cmath>
 
 namespace nertc_node
 {
@@ -350,6 +352,43 @@ static napi_status nertc_ls_users_obj_to_struct(Isolate* isolate, const Local<Ob
     return napi_ok;
 }
 
+void nertc_ls_user_apply_row(const double* row, nertc::NERtcLiveStreamUserTranscoding& user)
+{
+    if (!std::isnan(row[NODE_LS_USER_UID]))
+        user.uid = (nertc::uid_t)row[NODE_LS_USER_UID];
+    if (!std::isnan(row[NODE_LS_USER_VIDEO_PUSH]))
+        user.video_push = row[NODE_LS_USER_VIDEO_PUSH] != 0;
+    if (!std::isnan(row[NODE_LS_USER_ADAPTION]))
+        user.adaption = (nertc::NERtcLiveStreamVideoScaleMode)(int)row[NODE_LS_USER_ADAPTION];
+    if (!std::isnan(row[NODE_LS_USER_X]))
+        user.x = (int)row[NODE_LS_USER_X];
+    if (!std::isnan(row[NODE_LS_USER_Y]))
+        user.y = (int)row[NODE_LS_USER_Y];
+    if (!std::isnan(row[NODE_LS_USER_WIDTH]))
+        user.width = (int)row[NODE_LS_USER_WIDTH];
+    if (!std::isnan(row[NODE_LS_USER_HEIGHT]))
+        user.height = (int)row[NODE_LS_USER_HEIGHT];
+    if (!std::isnan(row[NODE_LS_USER_AUDIO_PUSH]))
+        user.audio_push = row[NODE_LS_USER_AUDIO_PUSH] != 0;
+    if (!std::isnan(row[NODE_LS_USER_Z_ORDER]))
+        user.z_order = (int)row[NODE_LS_USER_Z_ORDER];
+}
+
+// 按行解码 Float64Array 形式的成员布局，行数须与 user_count 一致
+static napi_status nertc_ls_users_table_to_struct(const Local<v8::Float64Array>& table, nertc::NERtcLiveStreamLayout& layout)
+{
+    if (table->Length() != (size_t)layout.user_count * NODE_LS_USER_FIELD_COUNT)
+        return napi_invalid_arg;
+    const double* data = reinterpret_cast<const double*>(
+        static_cast<const uint8_t*>(nim_napi_get_arraybuffer_data(table->Buffer())) + table->ByteOffset());
+    layout.users = new nertc::NERtcLiveStreamUserTranscoding[layout.user_count]();
+    for (auto i = 0; i < layout.user_count; i++)
+    {
+        nertc_ls_user_apply_row(data + i * NODE_LS_USER_FIELD_COUNT, layout.users[i]);
+    }
+    return napi_ok;
+}
+
 static napi_status nertc_ls_layout_obj_to_struct(Isolate* isolate, const Local<Object>& obj, nertc::NERtcLiveStreamLayout& layout)
 {
     int32_t out_i;
@@ -377,7 +416,12 @@ static napi_status nertc_ls_layout_obj_to_struct(Isolate* isolate, const Local<O
         Local<Value> so, so1;
         if (nim_napi_get_object_value(isolate, obj, "users", so) == napi_ok)
         {
-            if (so->IsArray())
+            if (so->IsFloat64Array())
+            {
+                if (nertc_ls_users_table_to_struct(so.As<v8::Float64Array>(), layout) != napi_ok)
+                    return napi_invalid_arg;
+            }
+            else if (so->IsArray())
             {
                 layout.users = new nertc::NERtcLiveStreamUserTranscoding[layout.user_count];
                 Local<Array> wl = so.As<Array>();
@@ -479,37 +523,9 @@ napi_status nertc_ls_task_info_obj_to_struct(Isolate* isolate, const Local<Objec
 
 napi_status nertc_stats_to_obj(Isolate* isolate, const nertc::NERtcStats& config, Local<Object>& obj)
 {
-    nim_napi_set_object_value_uint32(isolate, obj, "cpu_app_usage", config.cpu_app_usage);
-    nim_napi_set_object_value_uint32(isolate, obj, "cpu_idle_usage", config.cpu_idle_usage);
-    nim_napi_set_object_value_uint32(isolate, obj, "cpu_total_usage", config.cpu_total_usage);
-    nim_napi_set_object_value_uint32(isolate, obj, "memory_app_usage", config.memory_app_usage);
-    nim_napi_set_object_value_uint32(isolate, obj, "memory_total_usage", config.memory_total_usage);
-    nim_napi_set_object_value_uint32(isolate, obj, "memory_app_kbytes", config.memory_app_kbytes);
-    nim_napi_set_object_value_int32(isolate, obj, "total_duration", config.total_duration);
-    nim_napi_set_object_value_uint64(isolate, obj, "tx_bytes", config.tx_bytes);
-    nim_napi_set_object_value_uint64(isolate, obj, "rx_bytes", config.rx_bytes);
-    nim_napi_set_object_value_uint64(isolate, obj, "tx_audio_bytes", config.tx_audio_bytes);
-    nim_napi_set_object_value_uint64(isolate, obj, "tx_video_bytes", config.tx_video_bytes);
-    nim_napi_set_object_value_uint64(isolate, obj, "rx_audio_bytes", config.rx_audio_bytes);
-    nim_napi_set_object_value_uint64(isolate, obj, "rx_video_bytes", config.rx_video_bytes);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_audio_kbitrate", config.tx_audio_kbitrate);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_audio_kbitrate", config.rx_audio_kbitrate);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_video_kbitrate", config.tx_video_kbitrate);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_video_kbitrate", config.rx_video_kbitrate);
-    nim_napi_set_object_value_int32(isolate, obj, "up_rtt", config.up_rtt);
-    nim_napi_set_object_value_int32(isolate, obj, "down_rtt", config.down_rtt);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_audio_packet_loss_rate", config.tx_audio_packet_loss_rate);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_video_packet_loss_rate", config.tx_video_packet_loss_rate);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_audio_packet_loss_sum", config.tx_audio_packet_loss_sum);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_video_packet_loss_sum", config.tx_video_packet_loss_sum);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_audio_jitter", config.tx_audio_jitter);
-    nim_napi_set_object_value_int32(isolate, obj, "tx_video_jitter", config.tx_video_jitter);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_audio_packet_loss_rate", config.rx_audio_packet_loss_rate);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_video_packet_loss_rate", config.rx_video_packet_loss_rate);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_audio_packet_loss_sum", config.rx_audio_packet_loss_sum);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_video_packet_loss_sum", config.rx_video_packet_loss_sum);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_audio_jitter", config.rx_audio_jitter);
-    nim_napi_set_object_value_int32(isolate, obj, "rx_video_jitter", config.rx_video_jitter);
+#define NERTC_SET_STATS_FIELD(type, name) nim_napi_set_object_value_##type(isolate, obj, #name, config.name);
+    NERTC_STATS_FIELDS(NERTC_SET_STATS_FIELD)
+#undef NERTC_SET_STATS_FIELD
     return napi_ok;
 }
 
@@ -541,7 +557,7 @@ napi_status nertc_video_send_stats_to_obj(Isolate *isolate, const nertc::NERtcVi
     Local<Array> s = Array::New(isolate);
     for (auto i = 0; i < (int)config.video_layers_count; i++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_VIDEO_SEND_LAYER);
         nim_napi_set_object_value_int32(isolate, o, "layer_type", config.video_layers_list[i].layer_type);
         nim_napi_set_object_value_int32(isolate, o, "width", config.video_layers_list[i].width);
         nim_napi_set_object_value_int32(isolate, o, "height", config.video_layers_list[i].height);
@@ -555,7 +571,7 @@ napi_status nertc_video_send_stats_to_obj(Isolate *isolate, const nertc::NERtcVi
         nim_napi_set_object_value_utf8string(isolate, o, "codec_name", config.video_layers_list[i].codec_name);
         s->Set(isolate->GetCurrentContext(), i, o);
     }
-    obj->Set(isolate->GetCurrentContext(), nim_napi_new_utf8string(isolate, "video_layers_list"), s);
+    obj->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, "video_layers_list"), s);
 
     return napi_ok;
 }
@@ -567,7 +583,7 @@ napi_status nertc_video_recv_stats_to_obj(Isolate* isolate, const nertc::NERtcVi
     Local<Array> s = Array::New(isolate);
     for (int index = 0; index < config.video_layers_count; index++)
     {
-        Local<Object> o = Object::New(isolate);
+        Local<Object> o = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_VIDEO_RECV_LAYER);
         nim_napi_set_object_value_int32(isolate, o, "layer_type", config.video_layers_list[index].layer_type);
         nim_napi_set_object_value_int32(isolate, o, "width", config.video_layers_list[index].width);
         nim_napi_set_object_value_int32(isolate, o, "height", config.video_layers_list[index].height);
@@ -581,7 +597,7 @@ napi_status nertc_video_recv_stats_to_obj(Isolate* isolate, const nertc::NERtcVi
         nim_napi_set_object_value_utf8string(isolate, o, "codec_name", config.video_layers_list[index].codec_name);
         s->Set(isolate->GetCurrentContext(), index, o);
     }
-    obj->Set(isolate->GetCurrentContext(), nim_napi_new_utf8string(isolate, "video_layers_list"), s);
+    obj->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, "video_layers_list"), s);
     return napi_ok;
 }
 
@@ -599,4 +615,14 @@ napi_status nertc_audio_volume_info_to_obj(Isolate* isolate, const nertc::NERtcA
     nim_napi_set_object_value_uint32(isolate, obj, "volume", (uint32_t)config.volume);
     return napi_ok;
 }
+void nertc_preload_property_keys(Isolate* isolate)
+{
+    // 统计转换用到的属性名在 nertc_init_stats_templates 生成模板时已放入缓存
+    static const char* const frameKeys[] = {
+        "type", "uid", "channelId", "header", "ydata", "udata", "vdata", "sei",
+        "dirtyTiles", "tileSize", "columns", "rows", "map"
+    };
+    nim_node::key_cache::get_instance(isolate)->preload(isolate, frameKeys, sizeof(frameKeys) / sizeof(frameKeys[0]));
+}
+
 }
\ No newline at end of file
@@ -29,6 +29,59 @@ napi_status nertc_video_dimensions_obj_to_struct(Isolate* isolate, const Local<O
 napi_status nertc_screen_capture_params_obj_to_struct(Isolate* isolate, const Local<Object>& obj, nertc::NERtcScreenCaptureParameters& params);
 napi_status nertc_ls_task_info_obj_to_struct(Isolate* isolate, const Local<Object>& obj, nertc::NERtcLiveStreamTaskInfo& info);
 
+// 直播成员布局的二进制编码：layout.users 可传入 Float64Array，每个成员占一行，
+// 第 i 个成员的第 field 项位于 data[i * NODE_LS_USER_FIELD_COUNT + field]。
+// 与 JS 侧 NERtcLiveStreamUserField 一一对应，只允许在末尾追加
+enum NodeLiveStreamUserField
+{
+    NODE_LS_USER_UID = 0,
+    NODE_LS_USER_VIDEO_PUSH,
+    NODE_LS_USER_ADAPTION,
+    NODE_LS_USER_X,
+    NODE_LS_USER_Y,
+    NODE_LS_USER_WIDTH,
+    NODE_LS_USER_HEIGHT,
+    NODE_LS_USER_AUDIO_PUSH,
+    NODE_LS_USER_Z_ORDER,
+    NODE_LS_USER_FIELD_COUNT,
+};
+// 按一行编码修改成员布局，值为 NaN 的字段保持不变
+void nertc_ls_user_apply_row(const double* row, nertc::NERtcLiveStreamUserTranscoding& user);
+
+// NERtcStats 的字段与类型，nertc_stats_to_obj 与按需取值的统计对象共用，新增字段只需改这里
+#define NERTC_STATS_FIELDS(X) \
+    X(uint32, cpu_app_usage) \
+    X(uint32, cpu_idle_usage) \
+    X(uint32, cpu_total_usage) \
+    X(uint32, memory_app_usage) \
+    X(uint32, memory_total_usage) \
+    X(uint32, memory_app_kbytes) \
+    X(int32, total_duration) \
+    X(uint64, tx_bytes) \
+    X(uint64, rx_bytes) \
+    X(uint64, tx_audio_bytes) \
+    X(uint64, tx_video_bytes) \
+    X(uint64, rx_audio_bytes) \
+    X(uint64, rx_video_bytes) \
+    X(int32, tx_audio_kbitrate) \
+    X(int32, rx_audio_kbitrate) \
+    X(int32, tx_video_kbitrate) \
+    X(int32, rx_video_kbitrate) \
+    X(int32, up_rtt) \
+    X(int32, down_rtt) \
+    X(int32, tx_audio_packet_loss_rate) \
+    X(int32, tx_video_packet_loss_rate) \
+    X(int32, tx_audio_packet_loss_sum) \
+    X(int32, tx_video_packet_loss_sum) \
+    X(int32, tx_audio_jitter) \
+    X(int32, tx_video_jitter) \
+    X(int32, rx_audio_packet_loss_rate) \
+    X(int32, rx_video_packet_loss_rate) \
+    X(int32, rx_audio_packet_loss_sum) \
+    X(int32, rx_video_packet_loss_sum) \
+    X(int32, rx_audio_jitter) \
+    X(int32, rx_video_jitter)
+
 napi_status nertc_stats_to_obj(Isolate* isolate, const nertc::NERtcStats& config, Local<Object>& obj);
 napi_status nertc_audio_send_stats_to_obj(Isolate* isolate, const nertc::NERtcAudioSendStats& config, Local<Object>& obj);
 napi_status nertc_audio_recv_stats_to_obj(Isolate* isolate, const nertc::NERtcAudioRecvStats& config, Local<Object>& obj);
@@ -37,6 +90,9 @@ napi_status nertc_video_recv_stats_to_obj(Isolate* isolate, const nertc::NERtcVi
 napi_status nertc_network_quality_to_obj(Isolate* isolate, const nertc::NERtcNetworkQualityInfo& config, Local<Object>& obj);
 napi_status nertc_audio_volume_info_to_obj(Isolate* isolate, const nertc::NERtcAudioVolumeInfo& config, Local<Object>& obj);
 
+// 模块初始化时把视频帧投递用到的属性名放入 isolate 级缓存
+void nertc_preload_property_keys(Isolate* isolate);
+
 }
 
 #endif //NERTC_NODE_SDK_ENGINE_HELPER_H
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "nertc_node_latency_histogram.h"
+
+namespace nertc_node
+{
+NodeLatencyHistogram::NodeLatencyHistogram()
+: m_count(0)
+, m_sum(0)
+, m_max(0)
+{
+}
+
+void NodeLatencyHistogram::add(uint32_t ms)
+{
+    if (m_buckets.empty())
+        m_buckets.resize(LATENCY_HISTOGRAM_MAX_MS + 1, 0);
+    ++m_buckets[ms < LATENCY_HISTOGRAM_MAX_MS ? ms : LATENCY_HISTOGRAM_MAX_MS];
+    ++m_count;
+    m_sum += ms;
+    if (ms > m_max)
+        m_max = ms;
+}
+
+void NodeLatencyHistogram::reset()
+{
+    std::vector<uint32_t>().swap(m_buckets);
+    m_count = 0;
+    m_sum = 0;
+    m_max = 0;
+}
+
+uint32_t NodeLatencyHistogram::percentile(double p) const
+{
+    if (m_count == 0)
+        return 0;
+    uint64_t rank = (uint64_t)(p * m_count);
+    if (rank >= m_count)
+        rank = m_count - 1;
+    uint64_t seen = 0;
+    for (uint32_t ms = 0; ms < m_buckets.size(); ms++)
+    {
+        seen += m_buckets[ms];
+        if (seen > rank)
+            return ms;
+    }
+    return LATENCY_HISTOGRAM_MAX_MS;
+}
+
+} // namespace nertc_node
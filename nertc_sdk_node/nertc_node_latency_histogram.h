@@ -0,0 +1,36 @@
+#ifndef NERTC_NODE_LATENCY_HISTOGRAM_H
+#define NERTC_NODE_LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace nertc_node
+{
+#define LATENCY_HISTOGRAM_MAX_MS 1000
+
+    // 毫秒精度的时延直方图，0 ~ LATENCY_HISTOGRAM_MAX_MS 每毫秒一个桶，超出的计入最后一个桶。
+    // 首次写入时才分配桶，未开启统计的流不占内存。
+    class NodeLatencyHistogram
+    {
+    public:
+        NodeLatencyHistogram();
+
+        void add(uint32_t ms);
+        void reset();
+        // p 取值 0 ~ 1，返回对应分位所在桶的毫秒值，没有样本时返回 0
+        uint32_t percentile(double p) const;
+
+        uint64_t count() const { return m_count; }
+        uint32_t max() const { return m_max; }
+        double mean() const { return m_count ? (double)m_sum / m_count : 0; }
+
+    private:
+        std::vector<uint32_t> m_buckets;
+        uint64_t m_count;
+        uint64_t m_sum;
+        uint32_t m_max;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_LATENCY_HISTOGRAM_H
@@ -0,0 +1,94 @@
+#include "nertc_node_live_stream_cache.h"
+#include "nertc_node_engine_helper.h"
+#include <cmath>
+
+namespace nertc_node
+{
+void NodeLiveStreamCache::bindLayout(CachedTask &task)
+{
+    task.info.layout.user_count = (int)task.users.size();
+    task.info.layout.users = task.users.empty() ? nullptr : task.users.data();
+    task.info.layout.bg_image = task.hasBgImage ? &task.bgImage : nullptr;
+}
+
+void NodeLiveStreamCache::store(const nertc::NERtcLiveStreamTaskInfo &info)
+{
+    CachedTask &task = m_tasks[info.task_id];
+    task.info = info;
+    if (info.layout.users && info.layout.user_count > 0)
+        task.users.assign(info.layout.users, info.layout.users + info.layout.user_count);
+    else
+        task.users.clear();
+    task.hasBgImage = info.layout.bg_image != nullptr;
+    if (task.hasBgImage)
+        task.bgImage = *info.layout.bg_image;
+    bindLayout(task);
+}
+
+void NodeLiveStreamCache::remove(const std::string &taskId)
+{
+    m_tasks.erase(taskId);
+}
+
+void NodeLiveStreamCache::clear()
+{
+    m_tasks.clear();
+}
+
+const nertc::NERtcLiveStreamTaskInfo *NodeLiveStreamCache::applyUserChanges(const std::string &taskId, const double *rows, size_t rowCount,
+                                                                            const std::vector<nertc::uid_t> &removedUids)
+{
+    auto it = m_tasks.find(taskId);
+    if (it == m_tasks.end())
+        return nullptr;
+    CachedTask &task = it->second;
+    task.backup = task.users;
+
+    // 混流成员通常不超过几十个，顺序查找即可
+    for (size_t i = 0; i < rowCount; i++)
+    {
+        const double *row = rows + i * NODE_LS_USER_FIELD_COUNT;
+        if (std::isnan(row[NODE_LS_USER_UID]))
+            continue;
+        nertc::uid_t uid = (nertc::uid_t)row[NODE_LS_USER_UID];
+        nertc::NERtcLiveStreamUserTranscoding *user = nullptr;
+        for (auto &u : task.users)
+        {
+            if (u.uid == uid)
+            {
+                user = &u;
+                break;
+            }
+        }
+        if (!user)
+        {
+            task.users.push_back(nertc::NERtcLiveStreamUserTranscoding());
+            user = &task.users.back();
+        }
+        nertc_ls_user_apply_row(row, *user);
+    }
+    for (auto uid : removedUids)
+    {
+        for (auto u = task.users.begin(); u != task.users.end(); ++u)
+        {
+            if (u->uid == uid)
+            {
+                task.users.erase(u);
+                break;
+            }
+        }
+    }
+    bindLayout(task);
+    return &task.info;
+}
+
+void NodeLiveStreamCache::rollback(const std::string &taskId)
+{
+    auto it = m_tasks.find(taskId);
+    if (it == m_tasks.end())
+        return;
+    it->second.users.swap(it->second.backup);
+    bindLayout(it->second);
+}
+
+} // namespace nertc_node
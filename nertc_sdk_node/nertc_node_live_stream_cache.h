@@ -0,0 +1,51 @@
+#ifndef NERTC_NODE_LIVE_STREAM_CACHE_H
+#define NERTC_NODE_LIVE_STREAM_CACHE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+#include "nertc_engine_defines.h"
+
+namespace nertc_node
+{
+    // 已添加的直播推流任务在 native 层的副本，按 task_id 索引，只在 JS 线程访问。
+    // updateLiveStreamUsers 只传入发生变化的成员，在副本上修改后整体提交给 SDK，
+    // 不必每次由 JS 传入并重新转换完整的任务，成员数组的内存也反复复用
+    class NodeLiveStreamCache
+    {
+    public:
+        // 保存 addLiveStreamTask / updateLiveStreamTask 成功提交的任务，同 task_id 的旧副本被覆盖
+        void store(const nertc::NERtcLiveStreamTaskInfo &info);
+        void remove(const std::string &taskId);
+        void clear();
+
+        // 按 NodeLiveStreamUserField 的行格式修改成员：按 uid 匹配已有成员，值为 NaN 的字段保持不变；
+        // uid 不存在时追加为新成员，未给出的字段取 0。之后移除 removedUids 中的成员。
+        // 返回修改后的完整任务，任务不存在时返回 nullptr。提交失败时调用 rollback 恢复修改前的成员
+        const nertc::NERtcLiveStreamTaskInfo *applyUserChanges(const std::string &taskId, const double *rows, size_t rowCount,
+                                                               const std::vector<nertc::uid_t> &removedUids);
+        void rollback(const std::string &taskId);
+
+        size_t size() const { return m_tasks.size(); }
+
+    private:
+        struct CachedTask
+        {
+            nertc::NERtcLiveStreamTaskInfo info;
+            std::vector<nertc::NERtcLiveStreamUserTranscoding> users;
+            std::vector<nertc::NERtcLiveStreamUserTranscoding> backup;
+            nertc::NERtcLiveStreamImageInfo bgImage;
+            bool hasBgImage;
+        };
+
+        // 成员数组可能因追加而重新分配，修改后重新指向
+        static void bindLayout(CachedTask &task);
+
+    private:
+        std::map<std::string, CachedTask> m_tasks;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_LIVE_STREAM_CACHE_H
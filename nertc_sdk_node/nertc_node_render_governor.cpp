@@ -0,0 +1,44 @@
+#include "nertc_node_render_governor.h"
+#include <algorithm>
+
+namespace nertc_node
+{
+static double priorityCeiling(NodeStreamPriority priority, double demandFps)
+{
+    if (priority == NODE_STREAM_PRIORITY_OFFSCREEN)
+        return std::min(demandFps, GOVERNOR_OFFSCREEN_MAX_FPS);
+    return demandFps;
+}
+
+void allocateRenderRates(std::vector<GovernorStream *> &streams, uint64_t pixelBudget)
+{
+    double remaining = (double)pixelBudget;
+    for (int priority = 0; priority < NODE_STREAM_PRIORITY_COUNT; priority++)
+    {
+        double tierDemand = 0;
+        for (auto stream : streams)
+        {
+            if (stream->priority == priority)
+                tierDemand += priorityCeiling(stream->priority, stream->demandFps) * stream->pixels;
+        }
+        // 本档位能满足的比例，预算耗尽后为 0
+        double ratio = 1.0;
+        if (pixelBudget > 0 && tierDemand > 0)
+        {
+            ratio = std::max(0.0, std::min(1.0, remaining / tierDemand));
+            remaining = std::max(0.0, remaining - tierDemand);
+        }
+        for (auto stream : streams)
+        {
+            if (stream->priority != priority)
+                continue;
+            double ceiling = priorityCeiling(stream->priority, stream->demandFps);
+            if (ratio >= 1.0)
+                stream->targetFps = ceiling < stream->demandFps ? ceiling : 0;
+            else
+                stream->targetFps = std::max(GOVERNOR_MIN_FPS, ceiling * ratio);
+        }
+    }
+}
+
+} // namespace nertc_node
@@ -0,0 +1,37 @@
+#ifndef NERTC_NODE_RENDER_GOVERNOR_H
+#define NERTC_NODE_RENDER_GOVERNOR_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace nertc_node
+{
+    // 视频流的渲染优先级，由 JS 按画面布局设置，取值越小越优先
+    enum NodeStreamPriority
+    {
+        NODE_STREAM_PRIORITY_ACTIVE_SPEAKER = 0,
+        NODE_STREAM_PRIORITY_PINNED = 1,
+        NODE_STREAM_PRIORITY_VISIBLE = 2,
+        NODE_STREAM_PRIORITY_OFFSCREEN = 3,
+        NODE_STREAM_PRIORITY_COUNT
+    };
+
+#define GOVERNOR_MIN_FPS 1.0
+#define GOVERNOR_OFFSCREEN_MAX_FPS 2.0
+#define GOVERNOR_UPDATE_INTERVAL 1000
+
+    struct GovernorStream
+    {
+        NodeStreamPriority priority;
+        double demandFps; // 实际到达的帧率，已按投递频率封顶
+        uint32_t pixels;  // 投递分辨率的像素数
+        double targetFps; // 分配结果，0 表示不限
+    };
+
+    // 按优先级从高到低依次满足各流的需求（像素/秒），预算不足时当前档位内按需求等比例缩减，
+    // 更低档位只保留 GOVERNOR_MIN_FPS。pixelBudget 为 0 表示不限，只应用档位上限。
+    void allocateRenderRates(std::vector<GovernorStream *> &streams, uint64_t pixelBudget);
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_RENDER_GOVERNOR_H
@@ -0,0 +1,73 @@
+#include "nertc_node_sei_queue.h"
+#include <string.h>
+
+namespace nertc_node
+{
+NodeSEIMessageQueue::NodeSEIMessageQueue()
+: m_drainScheduled(false)
+, m_batchDelivery(false)
+, m_dropped(0)
+, m_filtered(0)
+{
+}
+
+bool NodeSEIMessageQueue::accept(nertc::uid_t uid, const char *data, uint32_t length) const
+{
+    if (!m_uidFilter.empty() && m_uidFilter.find(uid) == m_uidFilter.end())
+        return false;
+    if (!m_prefixFilter.empty())
+    {
+        if (length < m_prefixFilter.size())
+            return false;
+        if (memcmp(data, m_prefixFilter.data(), m_prefixFilter.size()) != 0)
+            return false;
+    }
+    return true;
+}
+
+bool NodeSEIMessageQueue::push(nertc::uid_t uid, const char *data, uint32_t length, bool &accepted)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    accepted = accept(uid, data, length);
+    if (!accepted)
+    {
+        ++m_filtered;
+        return false;
+    }
+    // JS 线程长时间未取走时丢弃新消息，避免无限增长
+    if (m_pending.payload.size() + length > SEI_QUEUE_MAX_PENDING_BYTES)
+    {
+        ++m_dropped;
+        return false;
+    }
+    SEIMessageEntry entry;
+    entry.uid = uid;
+    entry.offset = (uint32_t)m_pending.payload.size();
+    entry.length = length;
+    m_pending.payload.insert(m_pending.payload.end(), data, data + length);
+    m_pending.entries.push_back(entry);
+
+    if (m_drainScheduled)
+        return false;
+    m_drainScheduled = true;
+    return true;
+}
+
+void NodeSEIMessageQueue::drain(SEIMessageBatch &batch)
+{
+    batch.clear();
+    std::lock_guard<std::mutex> lck(m_lock);
+    std::swap(batch.payload, m_pending.payload);
+    std::swap(batch.entries, m_pending.entries);
+    m_drainScheduled = false;
+}
+
+void NodeSEIMessageQueue::setFilter(const std::vector<nertc::uid_t> &uids, const std::string &prefix)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_uidFilter.clear();
+    m_uidFilter.insert(uids.begin(), uids.end());
+    m_prefixFilter = prefix;
+}
+
+} // namespace nertc_node
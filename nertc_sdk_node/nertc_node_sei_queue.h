@@ -0,0 +1,71 @@
+#ifndef NERTC_NODE_SEI_QUEUE_H
+#define NERTC_NODE_SEI_QUEUE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <mutex>
+#include "nertc_engine_defines.h"
+
+namespace nertc_node
+{
+    struct SEIMessageEntry
+    {
+        nertc::uid_t uid;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    // 一批待投递的 SEI 消息：所有 payload 连续存放在 payload 中，entries 为偏移表
+    struct SEIMessageBatch
+    {
+        std::vector<char> payload;
+        std::vector<SEIMessageEntry> entries;
+
+        void clear()
+        {
+            payload.clear();
+            entries.clear();
+        }
+    };
+
+#define SEI_QUEUE_MAX_PENDING_BYTES (512 * 1024)
+
+    // SDK 回调线程写入，JS 线程批量取出。两块缓冲交替使用，clear 后保留容量，
+    // 稳定运行时不再为单条消息分配内存。
+    class NodeSEIMessageQueue
+    {
+    public:
+        NodeSEIMessageQueue();
+
+        // 返回 true 表示需要调度一次投递（此前没有待投递的批次）；accepted 表示消息是否通过了过滤
+        bool push(nertc::uid_t uid, const char *data, uint32_t length, bool &accepted);
+        // 交换出当前批次，batch 中原有的数据会被清空并作为下一次写入的缓冲
+        void drain(SEIMessageBatch &batch);
+
+        // uids 为空表示不过滤 uid，prefix 为空表示不过滤内容
+        void setFilter(const std::vector<nertc::uid_t> &uids, const std::string &prefix);
+        void setBatchDelivery(bool enable) { m_batchDelivery = enable; }
+        bool batchDelivery() const { return m_batchDelivery; }
+
+        uint64_t droppedCount() const { return m_dropped; }
+        uint64_t filteredCount() const { return m_filtered; }
+
+    private:
+        bool accept(nertc::uid_t uid, const char *data, uint32_t length) const;
+
+    private:
+        std::mutex m_lock;
+        SEIMessageBatch m_pending;
+        bool m_drainScheduled;
+        bool m_batchDelivery;
+        std::unordered_set<nertc::uid_t> m_uidFilter;
+        std::string m_prefixFilter;
+        uint64_t m_dropped;
+        uint64_t m_filtered;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_SEI_QUEUE_H
@@ -0,0 +1,118 @@
+#include "nertc_node_sei_sender.h"
+#include <chrono>
+
+namespace nertc_node
+{
+NodeSEISender::NodeSEISender(nertc::IRtcEngineEx *engine)
+: m_engine(engine)
+, m_rate(SEI_SENDER_DEFAULT_RATE)
+, m_stopFlag(false)
+, m_sent(0)
+, m_failed(0)
+{
+    m_thread.reset(new std::thread(&NodeSEISender::sendLoop, this));
+}
+
+NodeSEISender::~NodeSEISender()
+{
+    stop();
+}
+
+void NodeSEISender::stop()
+{
+    if (!m_thread.get())
+        return;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_stopFlag = true;
+    }
+    m_cond.notify_one();
+    if (m_thread->joinable())
+        m_thread->join();
+    m_thread.reset();
+    m_queue.clear();
+}
+
+void NodeSEISender::setRate(uint32_t perSecond)
+{
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_rate = perSecond > 0 ? perSecond : SEI_SENDER_DEFAULT_RATE;
+    }
+    m_cond.notify_one();
+}
+
+int NodeSEISender::enqueue(const std::vector<std::pair<const char *, size_t>> &messages, nertc::NERtcStreamChannelType type)
+{
+    int queued = 0;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        if (m_stopFlag)
+            return 0;
+        for (auto &message : messages)
+        {
+            if (m_queue.size() >= SEI_SENDER_MAX_QUEUE)
+                break;
+            std::unique_ptr<PendingSEI> pending;
+            if (!m_freeList.empty())
+            {
+                pending = std::move(m_freeList.back());
+                m_freeList.pop_back();
+            }
+            else
+            {
+                pending.reset(new PendingSEI());
+            }
+            pending->data.assign(message.first, message.first + message.second);
+            pending->type = type;
+            pending->retry = 0;
+            m_queue.push_back(std::move(pending));
+            ++queued;
+        }
+    }
+    m_cond.notify_one();
+    return queued;
+}
+
+void NodeSEISender::sendLoop()
+{
+    auto next = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lck(m_lock);
+    while (!m_stopFlag)
+    {
+        m_cond.wait(lck, [this]() { return m_stopFlag || !m_queue.empty(); });
+        if (m_stopFlag)
+            break;
+        // 两次发送之间至少间隔 1000 / m_rate 毫秒
+        if (std::chrono::steady_clock::now() < next)
+        {
+            m_cond.wait_until(lck, next, [this]() { return m_stopFlag; });
+            continue;
+        }
+        std::unique_ptr<PendingSEI> pending = std::move(m_queue.front());
+        m_queue.pop_front();
+        lck.unlock();
+
+        int ret = m_engine->sendSEIMsg(pending->data.data(), (int)pending->data.size(), pending->type);
+
+        lck.lock();
+        next = std::chrono::steady_clock::now() + std::chrono::milliseconds(1000 / m_rate);
+        if (ret == 0)
+        {
+            ++m_sent;
+        }
+        else if (++pending->retry < SEI_SENDER_MAX_RETRY)
+        {
+            // 发送失败通常是超出了 SDK 的频率限制，放回队首下个周期重试
+            m_queue.push_front(std::move(pending));
+            continue;
+        }
+        else
+        {
+            ++m_failed;
+        }
+        m_freeList.push_back(std::move(pending));
+    }
+}
+
+} // namespace nertc_node
@@ -0,0 +1,61 @@
+#ifndef NERTC_NODE_SEI_SENDER_H
+#define NERTC_NODE_SEI_SENDER_H
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <condition_variable>
+#include "nertc_engine_ex.h"
+
+namespace nertc_node
+{
+#define SEI_SENDER_DEFAULT_RATE 10
+#define SEI_SENDER_MAX_QUEUE 64
+#define SEI_SENDER_MAX_RETRY 3
+
+    // 批量发送的 SEI 在此排队，按限定的频率逐条交给 SDK 发送。
+    // SDK 要求发送频率不超过视频帧率（建议不超过 10 次/秒），超出时会直接失败。
+    class NodeSEISender
+    {
+    public:
+        explicit NodeSEISender(nertc::IRtcEngineEx *engine);
+        ~NodeSEISender();
+
+        // 返回成功入队的条数，队列已满时后续消息不入队
+        int enqueue(const std::vector<std::pair<const char *, size_t>> &messages, nertc::NERtcStreamChannelType type);
+        void setRate(uint32_t perSecond);
+        void stop();
+
+        uint64_t sentCount() const { return m_sent; }
+        uint64_t failedCount() const { return m_failed; }
+
+    private:
+        struct PendingSEI
+        {
+            std::vector<char> data;
+            nertc::NERtcStreamChannelType type;
+            uint32_t retry;
+        };
+
+        void sendLoop();
+
+    private:
+        nertc::IRtcEngineEx *m_engine;
+        std::mutex m_lock;
+        std::condition_variable m_cond;
+        std::deque<std::unique_ptr<PendingSEI>> m_queue;
+        std::vector<std::unique_ptr<PendingSEI>> m_freeList;
+        uint32_t m_rate;
+        bool m_stopFlag;
+        std::unique_ptr<std::thread> m_thread;
+        std::atomic<uint64_t> m_sent;
+        std::atomic<uint64_t> m_failed;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_SEI_SENDER_H
@@ -0,0 +1,97 @@
+#include "nertc_node_stats_snapshot.h"
+
+namespace nertc_node
+{
+NodeStatsSnapshot::NodeStatsSnapshot()
+: m_enabled(false)
+{
+    for (int i = 0; i < NODE_STATS_TABLE_COUNT; i++)
+        m_scheduled[i] = false;
+}
+
+bool NodeStatsSnapshot::commit(NodeStatsTableType type)
+{
+    if (m_scheduled[type])
+        return false;
+    m_scheduled[type] = true;
+    return true;
+}
+
+bool NodeStatsSnapshot::writeRemoteAudio(const nertc::NERtcAudioRecvStats *stats, unsigned int user_count)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    NodeStatsTable &table = m_pending[NODE_STATS_TABLE_REMOTE_AUDIO];
+    table.reset(user_count, NODE_REMOTE_AUDIO_STATS_COLUMN_COUNT);
+    for (unsigned int i = 0; i < user_count; i++)
+    {
+        table.column(NODE_REMOTE_AUDIO_STATS_UID)[i] = (double)stats[i].uid;
+        table.column(NODE_REMOTE_AUDIO_STATS_RECEIVED_BITRATE)[i] = stats[i].received_bitrate;
+        table.column(NODE_REMOTE_AUDIO_STATS_TOTAL_FROZEN_TIME)[i] = stats[i].total_frozen_time;
+        table.column(NODE_REMOTE_AUDIO_STATS_FROZEN_RATE)[i] = stats[i].frozen_rate;
+        table.column(NODE_REMOTE_AUDIO_STATS_AUDIO_LOSS_RATE)[i] = stats[i].audio_loss_rate;
+        table.column(NODE_REMOTE_AUDIO_STATS_VOLUME)[i] = stats[i].volume;
+    }
+    return commit(NODE_STATS_TABLE_REMOTE_AUDIO);
+}
+
+bool NodeStatsSnapshot::writeRemoteVideo(const nertc::NERtcVideoRecvStats *stats, unsigned int user_count)
+{
+    uint32_t rows = 0;
+    for (unsigned int i = 0; i < user_count; i++)
+    {
+        if (stats[i].video_layers_list && stats[i].video_layers_count > 0)
+            rows += stats[i].video_layers_count;
+    }
+
+    std::lock_guard<std::mutex> lck(m_lock);
+    NodeStatsTable &table = m_pending[NODE_STATS_TABLE_REMOTE_VIDEO];
+    table.reset(rows, NODE_REMOTE_VIDEO_STATS_COLUMN_COUNT);
+    uint32_t row = 0;
+    for (unsigned int i = 0; i < user_count; i++)
+    {
+        if (!stats[i].video_layers_list)
+            continue;
+        for (int j = 0; j < stats[i].video_layers_count; j++, row++)
+        {
+            const nertc::NERtcVideoLayerRecvStats &layer = stats[i].video_layers_list[j];
+            table.column(NODE_REMOTE_VIDEO_STATS_UID)[row] = (double)stats[i].uid;
+            table.column(NODE_REMOTE_VIDEO_STATS_LAYER_TYPE)[row] = layer.layer_type;
+            table.column(NODE_REMOTE_VIDEO_STATS_WIDTH)[row] = layer.width;
+            table.column(NODE_REMOTE_VIDEO_STATS_HEIGHT)[row] = layer.height;
+            table.column(NODE_REMOTE_VIDEO_STATS_RECEIVED_BITRATE)[row] = layer.received_bitrate;
+            table.column(NODE_REMOTE_VIDEO_STATS_RECEIVED_FRAME_RATE)[row] = layer.received_frame_rate;
+            table.column(NODE_REMOTE_VIDEO_STATS_DECODER_FRAME_RATE)[row] = layer.decoder_frame_rate;
+            table.column(NODE_REMOTE_VIDEO_STATS_RENDER_FRAME_RATE)[row] = layer.render_frame_rate;
+            table.column(NODE_REMOTE_VIDEO_STATS_PACKET_LOSS_RATE)[row] = layer.packet_loss_rate;
+            table.column(NODE_REMOTE_VIDEO_STATS_TOTAL_FROZEN_TIME)[row] = layer.total_frozen_time;
+            table.column(NODE_REMOTE_VIDEO_STATS_FROZEN_RATE)[row] = layer.frozen_rate;
+        }
+    }
+    return commit(NODE_STATS_TABLE_REMOTE_VIDEO);
+}
+
+bool NodeStatsSnapshot::writeNetworkQuality(const nertc::NERtcNetworkQualityInfo *infos, unsigned int user_count)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    NodeStatsTable &table = m_pending[NODE_STATS_TABLE_NETWORK_QUALITY];
+    table.reset(user_count, NODE_NETWORK_QUALITY_COLUMN_COUNT);
+    for (unsigned int i = 0; i < user_count; i++)
+    {
+        table.column(NODE_NETWORK_QUALITY_UID)[i] = (double)infos[i].uid;
+        table.column(NODE_NETWORK_QUALITY_TX_QUALITY)[i] = infos[i].tx_quality;
+        table.column(NODE_NETWORK_QUALITY_RX_QUALITY)[i] = infos[i].rx_quality;
+    }
+    return commit(NODE_STATS_TABLE_NETWORK_QUALITY);
+}
+
+void NodeStatsSnapshot::drain(NodeStatsTableType type, NodeStatsTable &table)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    std::swap(table.data, m_pending[type].data);
+    table.rows = m_pending[type].rows;
+    table.columns = m_pending[type].columns;
+    m_pending[type].rows = 0;
+    m_scheduled[type] = false;
+}
+
+} // namespace nertc_node
@@ -0,0 +1,104 @@
+#ifndef NERTC_NODE_STATS_SNAPSHOT_H
+#define NERTC_NODE_STATS_SNAPSHOT_H
+
+#include <stdint.h>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include "nertc_engine_defines.h"
+
+namespace nertc_node
+{
+    enum NodeStatsTableType
+    {
+        NODE_STATS_TABLE_REMOTE_AUDIO = 0,
+        NODE_STATS_TABLE_REMOTE_VIDEO = 1,
+        NODE_STATS_TABLE_NETWORK_QUALITY = 2,
+        NODE_STATS_TABLE_COUNT = 3,
+    };
+
+    // 以下列序号与 JS 侧 NERtcRemoteAudioStatsColumn 等枚举一一对应，只允许在末尾追加
+    enum NodeRemoteAudioStatsColumn
+    {
+        NODE_REMOTE_AUDIO_STATS_UID = 0,
+        NODE_REMOTE_AUDIO_STATS_RECEIVED_BITRATE,
+        NODE_REMOTE_AUDIO_STATS_TOTAL_FROZEN_TIME,
+        NODE_REMOTE_AUDIO_STATS_FROZEN_RATE,
+        NODE_REMOTE_AUDIO_STATS_AUDIO_LOSS_RATE,
+        NODE_REMOTE_AUDIO_STATS_VOLUME,
+        NODE_REMOTE_AUDIO_STATS_COLUMN_COUNT,
+    };
+
+    // 远端视频每个 layer 占一行
+    enum NodeRemoteVideoStatsColumn
+    {
+        NODE_REMOTE_VIDEO_STATS_UID = 0,
+        NODE_REMOTE_VIDEO_STATS_LAYER_TYPE,
+        NODE_REMOTE_VIDEO_STATS_WIDTH,
+        NODE_REMOTE_VIDEO_STATS_HEIGHT,
+        NODE_REMOTE_VIDEO_STATS_RECEIVED_BITRATE,
+        NODE_REMOTE_VIDEO_STATS_RECEIVED_FRAME_RATE,
+        NODE_REMOTE_VIDEO_STATS_DECODER_FRAME_RATE,
+        NODE_REMOTE_VIDEO_STATS_RENDER_FRAME_RATE,
+        NODE_REMOTE_VIDEO_STATS_PACKET_LOSS_RATE,
+        NODE_REMOTE_VIDEO_STATS_TOTAL_FROZEN_TIME,
+        NODE_REMOTE_VIDEO_STATS_FROZEN_RATE,
+        NODE_REMOTE_VIDEO_STATS_COLUMN_COUNT,
+    };
+
+    enum NodeNetworkQualityColumn
+    {
+        NODE_NETWORK_QUALITY_UID = 0,
+        NODE_NETWORK_QUALITY_TX_QUALITY,
+        NODE_NETWORK_QUALITY_RX_QUALITY,
+        NODE_NETWORK_QUALITY_COLUMN_COUNT,
+    };
+
+    // 按列存放的统计表：第 column 列第 row 行位于 data[column * rows + row]
+    struct NodeStatsTable
+    {
+        std::vector<double> data;
+        uint32_t rows;
+        uint32_t columns;
+
+        NodeStatsTable() : rows(0), columns(0) {}
+
+        void reset(uint32_t row_count, uint32_t column_count)
+        {
+            rows = row_count;
+            columns = column_count;
+            data.resize((size_t)row_count * column_count);
+        }
+        double *column(uint32_t index) { return data.data() + (size_t)index * rows; }
+    };
+
+    // SDK 统计回调线程写入，JS 线程取出。每类统计只保留最新一份，JS 线程来不及取走时
+    // 直接覆盖；两块缓冲交替使用并保留容量，稳定运行时不再分配内存。
+    class NodeStatsSnapshot
+    {
+    public:
+        NodeStatsSnapshot();
+
+        // 返回 true 表示需要调度一次投递（此前没有待投递的快照）
+        bool writeRemoteAudio(const nertc::NERtcAudioRecvStats *stats, unsigned int user_count);
+        bool writeRemoteVideo(const nertc::NERtcVideoRecvStats *stats, unsigned int user_count);
+        bool writeNetworkQuality(const nertc::NERtcNetworkQualityInfo *infos, unsigned int user_count);
+        // 交换出指定类型的快照，table 中原有的数据作为下一次写入的缓冲
+        void drain(NodeStatsTableType type, NodeStatsTable &table);
+
+        void setEnabled(bool enable) { m_enabled = enable; }
+        bool enabled() const { return m_enabled; }
+
+    private:
+        bool commit(NodeStatsTableType type);
+
+    private:
+        std::mutex m_lock;
+        NodeStatsTable m_pending[NODE_STATS_TABLE_COUNT];
+        bool m_scheduled[NODE_STATS_TABLE_COUNT];
+        std::atomic<bool> m_enabled;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_STATS_SNAPSHOT_H
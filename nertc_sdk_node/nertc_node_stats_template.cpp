@@ -0,0 +1,220 @@
+#include "nertc_node_stats_template.h"
+#include "nertc_node_engine_helper.h"
+#include "../shared/sdk_helper/nim_node_helper.h"
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+namespace nertc_node
+{
+// 最后一项为按需取值的 NERtcStats 模板
+using StatsTemplates = std::array<v8::Eternal<v8::ObjectTemplate>, NODE_STATS_SHAPE_COUNT + 1>;
+static const int kLazyStatsTemplate = NODE_STATS_SHAPE_COUNT;
+
+static std::mutex g_templateLock;
+static std::unordered_map<Isolate *, StatsTemplates *> g_templates;
+static thread_local Isolate *t_isolate = nullptr;
+static thread_local StatsTemplates *t_templates = nullptr;
+
+static void releaseTemplates(void *arg)
+{
+    StatsTemplates *templates = static_cast<StatsTemplates *>(arg);
+    {
+        std::lock_guard<std::mutex> lck(g_templateLock);
+        for (auto it = g_templates.begin(); it != g_templates.end(); ++it)
+        {
+            if (it->second == templates)
+            {
+                g_templates.erase(it);
+                break;
+            }
+        }
+    }
+    if (t_templates == templates)
+    {
+        t_isolate = nullptr;
+        t_templates = nullptr;
+    }
+    delete templates;
+}
+
+static StatsTemplates *getTemplates(Isolate *isolate, bool create)
+{
+    if (t_isolate == isolate && t_templates)
+        return t_templates;
+    std::lock_guard<std::mutex> lck(g_templateLock);
+    auto it = g_templates.find(isolate);
+    StatsTemplates *templates = it != g_templates.end() ? it->second : nullptr;
+    if (!templates && create)
+    {
+        templates = new StatsTemplates();
+        g_templates[isolate] = templates;
+        node::AddEnvironmentCleanupHook(isolate, releaseTemplates, templates);
+    }
+    if (templates)
+    {
+        t_isolate = isolate;
+        t_templates = templates;
+    }
+    return templates;
+}
+
+// 按样本对象的属性顺序与初值生成模板，数组等非基本类型的属性先占位为 null，由转换函数覆盖
+static void setTemplate(Isolate *isolate, StatsTemplates &templates, NodeStatsShape shape, const Local<Object> &sample)
+{
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<v8::ObjectTemplate> tpl = v8::ObjectTemplate::New(isolate);
+    Local<Array> names = sample->GetOwnPropertyNames(context).ToLocalChecked();
+    for (uint32_t i = 0; i < names->Length(); i++)
+    {
+        Local<Value> name = names->Get(context, i).ToLocalChecked();
+        Local<Value> value = sample->Get(context, name).ToLocalChecked();
+        if (value->IsObject())
+            value = v8::Null(isolate);
+        tpl->Set(name.As<v8::Name>(), value);
+    }
+    templates[shape].Set(isolate, tpl);
+}
+
+// 按需取值对象持有的原生快照，对象被回收时在弱回调中释放
+struct LazyStatsHolder
+{
+    nertc::NERtcStats stats;
+    v8::Global<Object> handle;
+};
+
+static void releaseLazyStats(const v8::WeakCallbackInfo<LazyStatsHolder> &info)
+{
+    LazyStatsHolder *holder = info.GetParameter();
+    holder->handle.Reset();
+    delete holder;
+}
+
+#define NERTC_LAZY_STATS_GETTER(type, name)                                                          \
+    static void getLazyStats_##name(Local<v8::Name>, const v8::PropertyCallbackInfo<Value> &info)   \
+    {                                                                                                \
+        LazyStatsHolder *holder = static_cast<LazyStatsHolder *>(                                    \
+            info.Holder()->GetAlignedPointerFromInternalField(0));                                   \
+        if (holder)                                                                                  \
+            info.GetReturnValue().Set(nim_napi_new_##type(info.GetIsolate(), holder->stats.name));  \
+    }
+NERTC_STATS_FIELDS(NERTC_LAZY_STATS_GETTER)
+#undef NERTC_LAZY_STATS_GETTER
+
+struct LazyStatsField
+{
+    const char *name;
+    v8::AccessorNameGetterCallback getter;
+};
+
+static const LazyStatsField kLazyStatsFields[] = {
+#define NERTC_LAZY_STATS_FIELD(type, name) {#name, getLazyStats_##name},
+    NERTC_STATS_FIELDS(NERTC_LAZY_STATS_FIELD)
+#undef NERTC_LAZY_STATS_FIELD
+};
+
+// 字段访问器用 SetLazyDataProperty 注册：首次读取后转为普通数据属性，之后的读取不再回调。
+// 模板上的访问器实例化时按注册的逆序出现，这里倒序注册，使属性顺序与完整转换的对象一致
+static void setLazyStatsTemplate(Isolate *isolate, StatsTemplates &templates)
+{
+    Local<v8::ObjectTemplate> tpl = v8::ObjectTemplate::New(isolate);
+    tpl->SetInternalFieldCount(1);
+    const size_t count = sizeof(kLazyStatsFields) / sizeof(kLazyStatsFields[0]);
+    for (size_t i = count; i > 0; i--)
+        tpl->SetLazyDataProperty(nim_napi_new_key(isolate, kLazyStatsFields[i - 1].name), kLazyStatsFields[i - 1].getter);
+    templates[kLazyStatsTemplate].Set(isolate, tpl);
+}
+
+static Local<Object> firstLayer(Isolate *isolate, const Local<Object> &sample)
+{
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Value> list;
+    nim_napi_get_object_value(isolate, sample, "video_layers_list", list);
+    return list.As<Array>()->Get(context, 0).ToLocalChecked().As<Object>();
+}
+
+void nertc_init_stats_templates(Isolate *isolate)
+{
+    HandleScope scope(isolate);
+    StatsTemplates &templates = *getTemplates(isolate, true);
+    Local<Object> sample;
+
+    nertc::NERtcStats stats = {};
+    sample = Object::New(isolate);
+    nertc_stats_to_obj(isolate, stats, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_RTC, sample);
+
+    nertc::NERtcAudioSendStats audioSend = {};
+    sample = Object::New(isolate);
+    nertc_audio_send_stats_to_obj(isolate, audioSend, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_AUDIO_SEND, sample);
+
+    nertc::NERtcAudioRecvStats audioRecv = {};
+    sample = Object::New(isolate);
+    nertc_audio_recv_stats_to_obj(isolate, audioRecv, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_AUDIO_RECV, sample);
+
+    // 带一个 layer 转换，同时得到 layer 对象的样本
+    nertc::NERtcVideoLayerSendStats sendLayer = {};
+    nertc::NERtcVideoSendStats videoSend = {};
+    videoSend.video_layers_list = &sendLayer;
+    videoSend.video_layers_count = 1;
+    sample = Object::New(isolate);
+    nertc_video_send_stats_to_obj(isolate, videoSend, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_VIDEO_SEND, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_VIDEO_SEND_LAYER, firstLayer(isolate, sample));
+
+    nertc::NERtcVideoLayerRecvStats recvLayer = {};
+    nertc::NERtcVideoRecvStats videoRecv = {};
+    videoRecv.video_layers_list = &recvLayer;
+    videoRecv.video_layers_count = 1;
+    sample = Object::New(isolate);
+    nertc_video_recv_stats_to_obj(isolate, videoRecv, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_VIDEO_RECV, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_VIDEO_RECV_LAYER, firstLayer(isolate, sample));
+
+    nertc::NERtcNetworkQualityInfo quality = {};
+    sample = Object::New(isolate);
+    nertc_network_quality_to_obj(isolate, quality, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_NETWORK_QUALITY, sample);
+
+    nertc::NERtcAudioVolumeInfo volume = {};
+    sample = Object::New(isolate);
+    nertc_audio_volume_info_to_obj(isolate, volume, sample);
+    setTemplate(isolate, templates, NODE_STATS_SHAPE_AUDIO_VOLUME, sample);
+
+    setLazyStatsTemplate(isolate, templates);
+}
+
+Local<Object> nertc_new_stats_obj(Isolate *isolate, NodeStatsShape shape)
+{
+    StatsTemplates *templates = getTemplates(isolate, false);
+    if (templates && !(*templates)[shape].IsEmpty())
+    {
+        Local<Object> obj;
+        if ((*templates)[shape].Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocal(&obj))
+            return obj;
+    }
+    return Object::New(isolate);
+}
+
+Local<Object> nertc_new_lazy_stats_obj(Isolate *isolate, const nertc::NERtcStats &stats)
+{
+    StatsTemplates *templates = getTemplates(isolate, false);
+    Local<Object> obj;
+    if (!templates || (*templates)[kLazyStatsTemplate].IsEmpty() ||
+        !(*templates)[kLazyStatsTemplate].Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocal(&obj))
+    {
+        obj = nertc_new_stats_obj(isolate, NODE_STATS_SHAPE_RTC);
+        nertc_stats_to_obj(isolate, stats, obj);
+        return obj;
+    }
+    LazyStatsHolder *holder = new LazyStatsHolder();
+    holder->stats = stats;
+    holder->handle.Reset(isolate, obj);
+    holder->handle.SetWeak(holder, releaseLazyStats, v8::WeakCallbackType::kParameter);
+    obj->SetAlignedPointerInInternalField(0, holder);
+    return obj;
+}
+
+} // namespace nertc_node
@@ -0,0 +1,36 @@
+#ifndef NERTC_NODE_STATS_TEMPLATE_H
+#define NERTC_NODE_STATS_TEMPLATE_H
+
+#include <node.h>
+#include "nertc_engine_defines.h"
+
+namespace nertc_node
+{
+    enum NodeStatsShape
+    {
+        NODE_STATS_SHAPE_RTC = 0,
+        NODE_STATS_SHAPE_AUDIO_SEND,
+        NODE_STATS_SHAPE_AUDIO_RECV,
+        NODE_STATS_SHAPE_VIDEO_SEND,
+        NODE_STATS_SHAPE_VIDEO_SEND_LAYER,
+        NODE_STATS_SHAPE_VIDEO_RECV,
+        NODE_STATS_SHAPE_VIDEO_RECV_LAYER,
+        NODE_STATS_SHAPE_NETWORK_QUALITY,
+        NODE_STATS_SHAPE_AUDIO_VOLUME,
+        NODE_STATS_SHAPE_COUNT
+    };
+
+    // 模块初始化时调用：各转换函数先输出一份空统计，按其属性顺序与初值生成 ObjectTemplate。
+    // 之后创建的统计对象一开始就带有全部属性，同类对象共享同一个隐藏类，填值时不再迁移
+    void nertc_init_stats_templates(v8::Isolate *isolate);
+
+    // 按模板创建统计对象；模板尚未生成时退化为 Object::New
+    v8::Local<v8::Object> nertc_new_stats_obj(v8::Isolate *isolate, NodeStatsShape shape);
+
+    // 创建按需取值的 NERtcStats 对象：只拷贝一份原生快照，字段在首次读取时才转换为 JS 值，
+    // 快照随对象被回收一起释放。模板尚未生成时退化为完整转换
+    v8::Local<v8::Object> nertc_new_lazy_stats_obj(v8::Isolate *isolate, const nertc::NERtcStats &stats);
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_STATS_TEMPLATE_H
@@ -0,0 +1,102 @@
+#include "nertc_node_video_frame_copy.h"
+#include <string.h>
+#include "libyuv.h"
+
+using namespace libyuv;
+namespace nertc_node
+{
+void copyAndCentreYuv(const unsigned char* srcYPlane, const unsigned char* srcUPlane, const unsigned char* srcVPlane, int width, int height, int srcStride,
+unsigned char* dstYPlane, unsigned char* dstUPlane, unsigned char* dstVPlane, int dstStride)
+{
+    if (srcStride == width && dstStride == width)
+    {
+        memcpy(dstYPlane, srcYPlane, width * height);
+        memcpy(dstUPlane, srcUPlane, width * height / 4);
+        memcpy(dstVPlane, srcVPlane, width * height / 4);
+        return;
+    }
+
+    int dstDiff = dstStride - width;
+    //RGB(0,0,0) to YUV(0,128,128)
+    memset(dstYPlane, 0, dstStride * height);
+    memset(dstUPlane, 128, dstStride * height / 4);
+    memset(dstVPlane, 128, dstStride * height / 4);
+
+    for (int i = 0; i < height; ++i)
+    {
+        memcpy(dstYPlane + (dstDiff >> 1), srcYPlane, width);
+        srcYPlane += srcStride;
+        dstYPlane += dstStride;
+
+        if (i % 2 == 0)
+        {
+            memcpy(dstUPlane + (dstDiff >> 2), srcUPlane, width >> 1);
+            srcUPlane += srcStride >> 1;
+            dstUPlane += dstStride >> 1;
+
+            memcpy(dstVPlane + (dstDiff >> 2), srcVPlane, width >> 1);
+            srcVPlane += srcStride >> 1;
+            dstVPlane += dstStride >> 1;
+        }
+    }
+}
+
+NodeVideoScaleFilter selectVideoScaleFilter(FrameScaleState& state, int srcWidth, int srcHeight, int width, int height)
+{
+    if (state.mode != NODE_VIDEO_SCALE_FILTER_AUTO)
+    {
+        state.current = state.mode;
+        return state.current;
+    }
+    // 缩小到一半以内时 box 与 bilinear 在 libyuv 中走同一路径；缩小超过一半时 nearest
+    // 混叠明显，box 对每个源像素取平均，小窗口画质最好。放大交给双线性
+    NodeVideoScaleFilter wanted;
+    if (width * 2 >= srcWidth && height * 2 >= srcHeight)
+        wanted = NODE_VIDEO_SCALE_FILTER_BILINEAR;
+    else
+        wanted = NODE_VIDEO_SCALE_FILTER_BOX;
+    if (++state.frames % SCALE_FILTER_RETRY_FRAMES == 0 && state.ceiling < NODE_VIDEO_SCALE_FILTER_BOX)
+    {
+        state.ceiling = (NodeVideoScaleFilter)(state.ceiling + 1);
+        state.costUs = 0;
+    }
+    NodeVideoScaleFilter filter = wanted < state.ceiling ? wanted : state.ceiling;
+    if (filter != state.current)
+        state.costUs = 0;
+    state.current = filter;
+    return filter;
+}
+
+void updateVideoScaleCost(FrameScaleState& state, std::chrono::steady_clock::time_point begin, uint32_t budgetUs)
+{
+    double cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+    state.costUs = state.costUs > 0 ? state.costUs * 0.9 + cost * 0.1 : cost;
+    if (state.mode == NODE_VIDEO_SCALE_FILTER_AUTO && state.costUs > budgetUs && state.current > NODE_VIDEO_SCALE_FILTER_NONE)
+    {
+        // 超出预算降一档，之后每 SCALE_FILTER_RETRY_FRAMES 帧重新尝试
+        state.ceiling = (NodeVideoScaleFilter)(state.current - 1);
+        state.costUs = 0;
+    }
+}
+
+void copyI420Frame(const IVideoFrame& videoFrame, FrameScaleState& scale, uint32_t scaleBudgetUs, int dest_stride, int src_stride, int width, int height,
+                   unsigned char* dstY, unsigned char* dstU, unsigned char* dstV)
+{
+    const unsigned char* planeY = videoFrame.buffer(IVideoFrame::Y_PLANE);
+    const unsigned char* planeU = videoFrame.buffer(IVideoFrame::U_PLANE);
+    const unsigned char* planeV = videoFrame.buffer(IVideoFrame::V_PLANE);
+
+    if (videoFrame.width == width && videoFrame.height == height)
+    {
+        copyAndCentreYuv(planeY, planeU, planeV, videoFrame.width, videoFrame.height, src_stride, dstY, dstU, dstV, dest_stride);
+        return;
+    }
+    int width2 = dest_stride / 2;
+    FilterMode filter = (FilterMode)selectVideoScaleFilter(scale, videoFrame.width, videoFrame.height, width, height);
+    auto begin = std::chrono::steady_clock::now();
+    I420Scale(planeY, videoFrame.stride[IVideoFrame::Y_PLANE], planeU, videoFrame.stride[IVideoFrame::U_PLANE], planeV, videoFrame.stride[IVideoFrame::V_PLANE],
+              videoFrame.width, videoFrame.height, (uint8_t*)dstY, dest_stride, (uint8_t*)dstU, width2, (uint8_t*)dstV, width2, width, height, filter);
+    updateVideoScaleCost(scale, begin, scaleBudgetUs);
+}
+
+} // namespace nertc_node
@@ -0,0 +1,26 @@
+#ifndef NERTC_NODE_VIDEO_FRAME_COPY_H
+#define NERTC_NODE_VIDEO_FRAME_COPY_H
+
+#include <stdint.h>
+#include <chrono>
+#include "nertc_node_video_frame_provider.h"
+
+// NodeVideoFrameTransporter 投递 I420 帧时的拷贝与缩放，不依赖传输器的状态，benchmark/transport_bench.cpp 直接测量
+namespace nertc_node
+{
+    // 按目标行宽居中拷贝，两侧填充黑色；源与目标都没有行填充时整块拷贝
+    void copyAndCentreYuv(const unsigned char *srcYPlane, const unsigned char *srcUPlane, const unsigned char *srcVPlane, int width, int height, int srcStride,
+                          unsigned char *dstYPlane, unsigned char *dstUPlane, unsigned char *dstVPlane, int dstStride);
+
+    // 自动档位按缩放比例选择，并受 state.ceiling 限制；手动档位直接返回设置值
+    NodeVideoScaleFilter selectVideoScaleFilter(FrameScaleState &state, int srcWidth, int srcHeight, int width, int height);
+    // 记录本次缩放耗时，自动档位超出 budgetUs 时降一档
+    void updateVideoScaleCost(FrameScaleState &state, std::chrono::steady_clock::time_point begin, uint32_t budgetUs);
+
+    // 尺寸相同时居中拷贝，否则以 I420Scale 缩放到 width x height；目标 Y 行宽为 dest_stride，U/V 为其一半
+    void copyI420Frame(const IVideoFrame &videoFrame, FrameScaleState &scale, uint32_t scaleBudgetUs, int dest_stride, int src_stride, int width, int height,
+                       unsigned char *dstY, unsigned char *dstU, unsigned char *dstV);
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_VIDEO_FRAME_COPY_H
@@ -1,13 +1,17 @@
 #include "nertc_node_video_frame_provider.h"
+#include "nertc_node_video_frame_copy.h"
 #include "../shared/sdk_helper/nim_node_helper.h"
 #include "../shared/sdk_helper/nim_node_async_queue.h"
 #include <chrono>
 #include <string>
+#include <algorithm>
 #include "libyuv.h"
 
 using namespace libyuv;
 namespace nertc_node
 {
+// 引擎自身频道的视频流以空频道名为键
+static const std::string kEngineChannel;
 NodeVideoFrameTransporter g_transport;
 NodeVideoFrameTransporter* getNodeVideoFrameTransporter()
 {
@@ -18,6 +22,13 @@ NodeVideoFrameTransporter::NodeVideoFrameTransporter()
 : init(false)
 , env(nullptr)
 , m_FPS(10)
+, m_sinkCount(0)
+, m_probeCount(0)
+, m_scaleBudgetUs(SCALE_FILTER_DEFAULT_BUDGET_US)
+, m_latencyStats(false)
+, m_pixelBudget(0)
+, m_governorUpdate(0)
+, m_attachSEI(false)
 {
     
 }
@@ -41,12 +52,23 @@ bool NodeVideoFrameTransporter::initialize(v8::Isolate *isolate, const v8::Funct
     return true;
 }
 
+bool NodeVideoFrameTransporter::initializeManualDrain(v8::Isolate *isolate)
+{
+    if (init) {
+        deinitialize();
+    }
+    m_stopFlag = false;
+    env = isolate;
+    init = true;
+    return true;
+}
+
 bool NodeVideoFrameTransporter::deinitialize()
 {
     if (!init)
         return true;
     m_stopFlag = 1;
-    if (m_thread->joinable())
+    if (m_thread && m_thread->joinable())
         m_thread->join();
     init = false;
     m_thread.reset();
@@ -56,7 +78,7 @@ bool NodeVideoFrameTransporter::deinitialize()
     return true;
 }
 
-int NodeVideoFrameTransporter::setVideoDimension(NodeRenderType type, nertc::uid_t uid, std::string channelId, uint32_t width, uint32_t height)
+int NodeVideoFrameTransporter::setVideoDimension(NodeRenderType type, nertc::uid_t uid, const std::string& channelId, uint32_t width, uint32_t height)
 {
     if (!init)
         return -1;
@@ -64,49 +86,478 @@ int NodeVideoFrameTransporter::setVideoDimension(NodeRenderType type, nertc::uid
     VideoFrameInfo& info = getVideoFrameInfo(type, uid, channelId);
     info.m_destWidth = width;
     info.m_destHeight = height;
+    info.m_dedup.hasHash = false;
+    info.m_tiles.reset();
+    info.m_scale.reset();
+    return 0;
+}
+
+int NodeVideoFrameTransporter::setVideoOutputFormat(NodeRenderType type, nertc::uid_t uid, NodeVideoOutputFormat format)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    VideoFrameInfo& info = getVideoFrameInfo(type, uid, kEngineChannel);
+    info.m_outputFormat = format;
+    info.m_dedup.hasHash = false;
+    info.m_tiles.reset();
+    return 0;
+}
+
+int NodeVideoFrameTransporter::setDuplicateFrameSuppression(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t sampleStep, uint32_t refreshInterval)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameDedupState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_dedup;
+    state.enabled = enable;
+    state.sampleStep = sampleStep > 0 ? sampleStep : DEDUP_DEFAULT_SAMPLE_STEP;
+    state.refreshInterval = refreshInterval;
+    state.hasHash = false;
+    state.checkedFrames = 0;
+    state.skippedFrames = 0;
+    return 0;
+}
+
+int NodeVideoFrameTransporter::setDirtyTileDelivery(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t tileSize, uint32_t refreshInterval)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameDirtyTileState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_tiles;
+    state.enabled = enable;
+    state.tileSize = tileSize;
+    state.refreshInterval = refreshInterval;
+    state.reset();
+    // 关闭后的缓冲在下一次拷贝时释放：投递回调中调用本接口时，packed 仍被 JS 引用
+    return 0;
+}
+
+int NodeVideoFrameTransporter::setVideoScaleFilter(NodeRenderType type, nertc::uid_t uid, NodeVideoScaleFilter filter)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameScaleState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_scale;
+    state.mode = filter;
+    state.reset();
+    return 0;
+}
+
+uint32_t NodeVideoFrameTransporter::monotonicMs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+}
+
+void NodeVideoFrameTransporter::setLatencyStats(bool enable)
+{
+    m_latencyStats = enable;
+    // 重新开启时清空已有统计
+    forEachVideoFrameInfo([enable](VideoFrameInfo& info) {
+        info.m_latency.enabled = enable;
+        info.m_latency.reset();
+    });
+}
+
+int NodeVideoFrameTransporter::setStreamPriority(NodeRenderType type, nertc::uid_t uid, NodeStreamPriority priority)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    getVideoFrameInfo(type, uid, kEngineChannel).m_governor.priority = priority;
+    // 下一次投递时立即重新分配
+    m_governorUpdate = 0;
     return 0;
 }
 
-VideoFrameInfo& NodeVideoFrameTransporter::getVideoFrameInfo(NodeRenderType type, nertc::uid_t uid, std::string channelId)
+int NodeVideoFrameTransporter::setStreamVisibility(NodeRenderType type, nertc::uid_t uid, bool visible, uint32_t thumbnailInterval, uint32_t thumbnailScale)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    VideoFrameInfo& info = getVideoFrameInfo(type, uid, kEngineChannel);
+    FrameVisibilityState& state = info.m_visibility;
+    bool wasVisible = state.visible;
+    state.visible = visible;
+    state.thumbnailInterval = thumbnailInterval;
+    state.thumbnailScale = thumbnailScale > 1 ? thumbnailScale : 1;
+    state.lastThumbnail = 0;
+    if (!visible && wasVisible)
+    {
+        // 尚未投递的帧留在缓冲中，等重新可见时再投递
+        info.m_needUpdate = false;
+    }
+    else if (visible && !wasVisible)
+    {
+        if (state.hasFullFrame)
+        {
+            // 换回隐藏前的完整画面，缩略帧的缓冲留作下次使用；
+            // 去重哈希记录的是缩略帧的源帧，清掉以免下一帧相同内容被跳过而一直显示旧画面
+            std::swap(info.m_buffer, state.fullFrame);
+            std::swap(info.m_bufferList, state.fullFramePlanes);
+            state.hasFullFrame = false;
+            info.m_dedup.hasHash = false;
+        }
+        if (!info.m_buffer.empty())
+        {
+            // 渲染端可能已重建，脏块模式下先补一帧完整画面
+            info.m_tiles.needFull = true;
+            info.m_needUpdate = true;
+            state.redisplay = true;
+        }
+    }
+    m_governorUpdate = 0;
+    return 0;
+}
+
+void NodeVideoFrameTransporter::setRenderPixelBudget(uint64_t pixelsPerSecond)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_pixelBudget = pixelsPerSecond;
+    m_governorUpdate = 0;
+}
+
+void NodeVideoFrameTransporter::updateRenderGovernor()
+{
+    uint32_t now = monotonicMs();
+    if (m_governorUpdate != 0 && now - m_governorUpdate < GOVERNOR_UPDATE_INTERVAL)
+        return;
+    m_governorUpdate = now ? now : 1;
+
+    std::vector<GovernorStream> streams;
+    std::vector<VideoFrameInfo*> infos;
+    auto collect = [&](VideoFrameInfo& info) {
+        GovernorStream stream;
+        stream.priority = info.m_governor.priority;
+        // 投递频率之上的部分本来就会被合并，不计入需求
+        stream.demandFps = std::min(info.m_stats.receivedRate.current(now), (double)m_FPS);
+        const FrameVisibilityState& visibility = info.m_visibility;
+        if (!visibility.visible)
+            stream.demandFps = visibility.thumbnailInterval ? std::min(stream.demandFps, 1000.0 / visibility.thumbnailInterval) : 0;
+        stream.pixels = info.m_governor.pixels;
+        stream.targetFps = 0;
+        streams.push_back(stream);
+        infos.push_back(&info);
+    };
+    for (auto& channel : m_remoteVideoFrames)
+        for (auto& it : channel.second)
+            collect(it.second);
+    for (auto& channel : m_substreamVideoFrame)
+        for (auto& it : channel.second)
+            collect(it.second);
+    if (m_localVideoFrame.get())
+        collect(*m_localVideoFrame.get());
+    if (m_localSubStreamVideoFrame.get())
+        collect(*m_localSubStreamVideoFrame.get());
+
+    std::vector<GovernorStream*> pointers;
+    for (auto& stream : streams)
+        pointers.push_back(&stream);
+    allocateRenderRates(pointers, m_pixelBudget);
+    for (size_t i = 0; i < infos.size(); i++)
+        infos[i]->m_governor.targetFps = streams[i].targetFps;
+}
+
+void NodeVideoFrameTransporter::onVideoFrameRendered(NodeRenderType type, nertc::uid_t uid, uint32_t timestamp)
+{
+    uint32_t now = monotonicMs();
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameLatencyState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_latency;
+    if (!state.enabled)
+        return;
+    // 32 位毫秒值的差按无符号计算，回绕后仍然正确
+    state.arriveToRender.add(now - timestamp);
+    if (timestamp == state.lastArrival)
+        state.deliverToRender.add(now - state.lastDeliver);
+}
+
+void NodeVideoFrameTransporter::getLatencyStats(NodeRenderType type, nertc::uid_t uid, NodeLatencyHistogram &arriveToDeliver, NodeLatencyHistogram &deliverToRender, NodeLatencyHistogram &arriveToRender)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameLatencyState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_latency;
+    arriveToDeliver = state.arriveToDeliver;
+    deliverToRender = state.deliverToRender;
+    arriveToRender = state.arriveToRender;
+}
+
+void NodeVideoFrameTransporter::getDuplicateFrameStats(NodeRenderType type, nertc::uid_t uid, uint64_t &checkedFrames, uint64_t &skippedFrames)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    FrameDedupState& state = getVideoFrameInfo(type, uid, kEngineChannel).m_dedup;
+    checkedFrames = state.checkedFrames;
+    skippedFrames = state.skippedFrames;
+}
+
+int NodeVideoFrameTransporter::startVideoFrameDump(NodeRenderType type, nertc::uid_t uid, const std::string &path, NodeVideoSinkFormat format)
+{
+    std::shared_ptr<NodeVideoFrameSink> sink(new NodeVideoFrameSink(path, format));
+    if (!sink->start())
+        return -1;
+    std::shared_ptr<NodeVideoFrameSink> old;
+    {
+        std::lock_guard<std::mutex> lck(m_sinkLock);
+        auto &slot = m_frameSinks[std::make_pair(type, uid)];
+        old = std::move(slot);
+        slot = std::move(sink);
+        m_sinkCount = (uint32_t)m_frameSinks.size();
+    }
+    // 在锁外停止旧的写线程，避免阻塞视频回调
+    if (old)
+        old->stop();
+    return 0;
+}
+
+int NodeVideoFrameTransporter::stopVideoFrameDump(NodeRenderType type, nertc::uid_t uid)
+{
+    std::shared_ptr<NodeVideoFrameSink> sink;
+    {
+        std::lock_guard<std::mutex> lck(m_sinkLock);
+        auto it = m_frameSinks.find(std::make_pair(type, uid));
+        if (it == m_frameSinks.end())
+            return -1;
+        sink = std::move(it->second);
+        m_frameSinks.erase(it);
+        m_sinkCount = (uint32_t)m_frameSinks.size();
+    }
+    // 视频回调可能仍持有引用，这里先停止写线程，之后到达的帧直接丢弃
+    sink->stop();
+    return 0;
+}
+
+int NodeVideoFrameTransporter::setVideoQualityProbe(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t interval, NodeQualityReference reference)
+{
+    std::unique_ptr<NodeVideoQualityProbe> old;
+    {
+        std::lock_guard<std::mutex> lck(m_probeLock);
+        auto &slot = m_qualityProbes[std::make_pair(type, uid)];
+        old = std::move(slot);
+        if (enable)
+            slot.reset(new NodeVideoQualityProbe(interval, reference));
+        else
+            m_qualityProbes.erase(std::make_pair(type, uid));
+        m_probeCount = (uint32_t)m_qualityProbes.size();
+    }
+    // 在锁外停止旧的计算线程，避免阻塞视频回调
+    old.reset();
+    return 0;
+}
+
+bool NodeVideoFrameTransporter::getVideoQualityProbeStats(NodeRenderType type, nertc::uid_t uid, NodeQualityProbeStats &stats)
+{
+    std::lock_guard<std::mutex> lck(m_probeLock);
+    auto it = m_qualityProbes.find(std::make_pair(type, uid));
+    if (it == m_qualityProbes.end())
+        return false;
+    it->second->getStats(stats);
+    return true;
+}
+
+void NodeVideoFrameTransporter::setAttachSEIToFrame(bool enable)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_attachSEI = enable;
+    if (!enable)
+    {
+        m_pendingSEI.clear();
+        for (auto& channel : m_remoteVideoFrames)
+            for (auto& it : channel.second)
+                it.second.m_sei.clear();
+    }
+}
+
+void NodeVideoFrameTransporter::setChannelName(const std::string& channelName)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_channelName = channelName;
+    for (ChannelVideoFrameMap* frames : { &m_remoteVideoFrames, &m_substreamVideoFrame })
+    {
+        auto channel = frames->find(kEngineChannel);
+        if (channel == frames->end())
+            continue;
+        for (auto& it : channel->second)
+            it.second.m_channelId = channelName;
+    }
+    if (m_localVideoFrame.get())
+        m_localVideoFrame->m_channelId = channelName;
+    if (m_localSubStreamVideoFrame.get())
+        m_localSubStreamVideoFrame->m_channelId = channelName;
+}
+
+void NodeVideoFrameTransporter::onSEIMessage(nertc::uid_t uid, const char *data, uint32_t length)
+{
+    if (!m_attachSEI)
+        return;
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_pendingSEI[uid].append(data, length);
+}
+
+VideoFrameInfo& NodeVideoFrameTransporter::getChannelVideoFrameInfo(ChannelVideoFrameMap& frames, NodeRenderType type, nertc::uid_t uid, const std::string& channelId)
+{
+    // 已有的流两次查找即可命中，不构造任何临时对象
+    auto channel = frames.find(channelId);
+    if (channel == frames.end())
+        channel = frames.emplace(channelId, VideoFrameMap()).first;
+    auto it = channel->second.find(uid);
+    if (it == channel->second.end())
+        it = channel->second.emplace(uid, VideoFrameInfo(type, uid, channelId.empty() ? m_channelName : channelId)).first;
+    return it->second;
+}
+
+VideoFrameInfo& NodeVideoFrameTransporter::getVideoFrameInfo(NodeRenderType type, nertc::uid_t uid, const std::string& channelId)
 {
     if (type == NodeRenderType::NODE_RENDER_TYPE_LOCAL) {
         if (!m_localVideoFrame.get())
-            m_localVideoFrame.reset(new VideoFrameInfo(NODE_RENDER_TYPE_LOCAL));
+            m_localVideoFrame.reset(new VideoFrameInfo(NODE_RENDER_TYPE_LOCAL, 0, m_channelName));
         return *m_localVideoFrame.get();
     }
     else if (type == NODE_RENDER_TYPE_REMOTE) {
-        auto it = m_remoteVideoFrames.find(uid);
-        if (it == m_remoteVideoFrames.end()) {
-            m_remoteVideoFrames[uid] = VideoFrameInfo(NODE_RENDER_TYPE_REMOTE, uid, channelId);
-        }
-        return m_remoteVideoFrames[uid];
+        return getChannelVideoFrameInfo(m_remoteVideoFrames, NODE_RENDER_TYPE_REMOTE, uid, channelId);
     }
     else if (type == NODE_RENDER_TYPE_LOCAL_SUBSTREAM) {
         if (!m_localSubStreamVideoFrame.get()) {
-            m_localSubStreamVideoFrame.reset(new VideoFrameInfo(NODE_RENDER_TYPE_LOCAL_SUBSTREAM));
+            m_localSubStreamVideoFrame.reset(new VideoFrameInfo(NODE_RENDER_TYPE_LOCAL_SUBSTREAM, 0, m_channelName));
         }
         return *m_localSubStreamVideoFrame.get();
     }
-    else if (type == NODE_RENDER_TYPE_REMOTE_SUBSTREAM) {
-        auto it = m_substreamVideoFrame.find(uid);
-        if (it == m_substreamVideoFrame.end()) {
-            m_substreamVideoFrame[uid] = VideoFrameInfo(NODE_RENDER_TYPE_REMOTE_SUBSTREAM, uid, channelId);
+    else {
+        return getChannelVideoFrameInfo(m_substreamVideoFrame, NODE_RENDER_TYPE_REMOTE_SUBSTREAM, uid, channelId);
+    }
+}
+
+NodeVideoCanvasContext* NodeVideoFrameTransporter::getVideoCanvasContext(NodeRenderType type, nertc::uid_t uid, const std::string& channelId)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    std::unique_ptr<NodeVideoCanvasContext>& context = m_canvasContexts[std::make_tuple(type, channelId, uid)];
+    if (!context)
+    {
+        context.reset(new NodeVideoCanvasContext());
+        context->renderType = type;
+        context->uid = uid;
+        context->channelId = channelId;
+        context->info = &getVideoFrameInfo(type, uid, channelId);
+    }
+    // 每次设置画布都会调用，渲染端已重建、没有基准帧，脏块模式下先补一帧完整画面
+    VideoFrameInfo& info = *context->info;
+    info.m_tiles.needFull = true;
+    if (!info.m_buffer.empty())
+        info.m_needUpdate = true;
+    return context.get();
+}
+
+void NodeVideoFrameTransporter::releaseVideoCanvasContexts()
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    m_canvasContexts.clear();
+}
+
+void NodeVideoFrameTransporter::pushFrameToSink(NodeRenderType type, nertc::uid_t uid, const IVideoFrame& videoFrame)
+{
+    if (m_sinkCount > 0)
+    {
+        std::shared_ptr<NodeVideoFrameSink> sink;
+        {
+            std::lock_guard<std::mutex> lck(m_sinkLock);
+            auto it = m_frameSinks.find(std::make_pair(type, uid));
+            if (it != m_frameSinks.end())
+                sink = it->second;
         }
-        return m_substreamVideoFrame[uid];
+        // dump 按原始分辨率写入，与渲染缩放无关；拷贝在锁外进行，一路 dump 变慢不会拖住其他流的视频回调
+        if (sink)
+            sink->pushFrame(videoFrame);
     }
 }
 
-int NodeVideoFrameTransporter::deliverFrame_I420(NodeRenderType type, nertc::uid_t uid, std::string channelId, const IVideoFrame& videoFrame, int rotation, bool mirrored)
+int NodeVideoFrameTransporter::deliverFrame_I420(NodeRenderType type, nertc::uid_t uid, const std::string& channelId, const IVideoFrame& videoFrame, int rotation, bool mirrored)
 {
+    uint32_t arrival = monotonicMs();
+    pushFrameToSink(type, uid, videoFrame);
     if (!init)
         return -1;
-        
+    std::lock_guard<std::mutex> frameLock(m_frameLock);
     std::lock_guard<std::mutex> lck(m_lock);
-    VideoFrameInfo& info = getVideoFrameInfo(type, uid, channelId);
-    int destStride = info.m_destWidth ? info.m_destWidth : videoFrame.stride[0];
+    return deliverFrameLocked(getVideoFrameInfo(type, uid, channelId), channelId.empty(), arrival, videoFrame, rotation, mirrored);
+}
+
+int NodeVideoFrameTransporter::deliverFrame_I420(NodeVideoCanvasContext& context, const IVideoFrame& videoFrame, int rotation, bool mirrored)
+{
+    uint32_t arrival = monotonicMs();
+    pushFrameToSink(context.renderType, context.uid, videoFrame);
+    if (!init)
+        return -1;
+    std::lock_guard<std::mutex> frameLock(m_frameLock);
+    std::lock_guard<std::mutex> lck(m_lock);
+    return deliverFrameLocked(*context.info, context.channelId.empty(), arrival, videoFrame, rotation, mirrored);
+}
+
+int NodeVideoFrameTransporter::deliverFrameLocked(VideoFrameInfo& info, bool engineChannel, uint32_t arrival, const IVideoFrame& videoFrame, int rotation, bool mirrored)
+{
+    NodeRenderType type = info.m_renderType;
+    nertc::uid_t uid = info.m_uid;
+    ++info.m_stats.receivedFrames;
+    info.m_stats.receivedRate.tick(arrival);
+    FrameVisibilityState& visibility = info.m_visibility;
+    if (!visibility.visible)
+    {
+        // 不可见时只在缩略图间隔到达后拷贝，其余帧连哈希都不做
+        if (visibility.thumbnailInterval == 0 || (visibility.lastThumbnail != 0 && arrival - visibility.lastThumbnail < visibility.thumbnailInterval))
+        {
+            ++info.m_stats.hiddenFrames;
+            return 0;
+        }
+        visibility.lastThumbnail = arrival ? arrival : 1;
+    }
+    FrameGovernorState& governor = info.m_governor;
+    // 间隔留 10% 余量，避免到达抖动使实际帧率低于分配值。
+    // 先于去重判断：被限流的帧不能记入哈希，否则其后相同的帧会被当作重复，画面变化要等到强制刷新才投递
+    if (governor.targetFps > 0 && arrival - governor.lastAccept < 900 / governor.targetFps)
+    {
+        // 低优先级的流按分配的帧率跳过拷贝
+        ++info.m_stats.throttledFrames;
+        return 0;
+    }
+    if (info.m_dedup.enabled)
+    {
+        // 有待挂载的 SEI 时照常投递，避免 SEI 被延后到强制刷新
+        bool pendingSEI = false;
+        if (m_attachSEI && type == NODE_RENDER_TYPE_REMOTE && engineChannel)
+        {
+            auto it = m_pendingSEI.find(uid);
+            pendingSEI = it != m_pendingSEI.end() && !it->second.empty();
+        }
+        if (isDuplicateFrame(videoFrame, info.m_dedup) && !pendingSEI)
+        {
+            ++info.m_stats.suppressedFrames;
+            return 0;
+        }
+    }
+    governor.lastAccept = arrival;
+    bool rgba = info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_RGBA || info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_BGRA;
+    bool nv12 = info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_NV12;
     int destWidth = info.m_destWidth ? info.m_destWidth : videoFrame.width;
     int destHeight = info.m_destHeight ? info.m_destHeight : videoFrame.height;
-    size_t imageSize = sizeof(image_header_type) + destStride * destHeight * 3 / 2;
+    if (nv12)
+    {
+        // UV 按 2x2 交错，奇数宽高时 I420ToNV12 每行多写一个 UV 对、多写一行，输出取偶数尺寸
+        destWidth = std::max(2, destWidth & ~1);
+        destHeight = std::max(2, destHeight & ~1);
+    }
+    // RGBA/NV12 输出不做居中填充，行宽即为图像宽度
+    int destStride = (rgba || nv12) ? destWidth : (info.m_destWidth ? info.m_destWidth : videoFrame.stride[0]);
+    if (!visibility.visible)
+    {
+        if (!visibility.hasFullFrame)
+        {
+            // 保留最后一帧完整画面供重新可见时补投，缩略帧写入另一块缓冲
+            std::swap(info.m_buffer, visibility.fullFrame);
+            std::swap(info.m_bufferList, visibility.fullFramePlanes);
+            visibility.hasFullFrame = true;
+        }
+        // 缩略帧按比例缩小，宽高保持偶数，不做居中填充
+        destWidth = std::max(2, destWidth / (int)visibility.thumbnailScale & ~1);
+        destHeight = std::max(2, destHeight / (int)visibility.thumbnailScale & ~1);
+        destStride = destWidth;
+    }
+    size_t imageSize = sizeof(image_header_type) + (rgba ? destStride * destHeight * 4 : destStride * destHeight * 3 / 2);
+    bool tiles = info.m_tiles.enabled && info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_I420;
+    if (tiles)
+    {
+        // 上一帧保留用于比较，新帧写入另一块缓冲
+        std::swap(info.m_buffer, info.m_tiles.previous);
+    }
+    else if (!info.m_tiles.previous.empty())
+    {
+        stream_buffer_type().swap(info.m_tiles.previous);
+        stream_buffer_type().swap(info.m_tiles.packed);
+    }
     auto s = info.m_buffer.size();
     if (s < imageSize || s >= imageSize * 2)
         info.m_buffer.resize(imageSize);
@@ -133,9 +584,43 @@ int NodeVideoFrameTransporter::deliverFrame_I420(NodeRenderType type, nertc::uid
     }
     hdr->rotation = htons(rotation);
     setupFrameHeader(hdr, destStride, destWidth, destHeight);
-    copyFrame(videoFrame, info, destStride, videoFrame.stride[0], destWidth, destHeight);
+    hdr->format = (uint8_t)info.m_outputFormat;
+    hdr->timestamp = htonl(arrival);
+    if (info.m_needUpdate)
+        ++info.m_stats.coalescedFrames;
+    auto copyBegin = std::chrono::steady_clock::now();
+    info.m_latency.arrival = arrival;
+    info.m_latency.enabled = m_latencyStats;
+    if (rgba)
+        convertFrameToRGBA(videoFrame, info, destWidth, destHeight);
+    else if (nv12)
+        convertFrameToNV12(videoFrame, info, destWidth, destHeight);
+    else
+        copyFrame(videoFrame, info, destStride, videoFrame.stride[0], destWidth, destHeight);
+    governor.pixels = destWidth * destHeight;
+    FrameTransportStats& stats = info.m_stats;
+    ++stats.copiedFrames;
+    if (videoFrame.width != (uint32_t)destWidth || videoFrame.height != (uint32_t)destHeight)
+        ++stats.scaledFrames;
+    stats.copiedBytes += imageSize;
+    stats.copyTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - copyBegin).count();
+    if (tiles)
+        updateDirtyTiles(info, destStride, destHeight);
+    if (m_probeCount > 0)
+        probeQuality(type, uid, videoFrame, info, destStride, destWidth, destHeight);
+    if (m_attachSEI && type == NODE_RENDER_TYPE_REMOTE && engineChannel)
+    {
+        // 收到的 SEI 挂到其后第一帧上；该帧被后续帧覆盖前未投递时继续累积
+        auto it = m_pendingSEI.find(uid);
+        if (it != m_pendingSEI.end() && !it->second.empty())
+        {
+            info.m_sei.append(it->second);
+            it->second.clear();
+        }
+    }
     info.m_count = 0;
     info.m_needUpdate = true;
+    visibility.redisplay = false;
     // if (videoFrame.data)
     // {
     //     delete videoFrame.data;
@@ -144,6 +629,88 @@ int NodeVideoFrameTransporter::deliverFrame_I420(NodeRenderType type, nertc::uid
     return 0;
 }
 
+static uint32_t sampleFrameHash(const IVideoFrame& videoFrame, uint32_t step)
+{
+    uint32_t hash = HashDjb2(nullptr, 0, (videoFrame.width << 16) ^ videoFrame.height ^ (videoFrame.rotation << 8));
+    for (int plane = IVideoFrame::Y_PLANE; plane < IVideoFrame::NUM_OF_PLANES; plane++)
+    {
+        const uint8_t* data = videoFrame.buffer((IVideoFrame::PLANE_TYPE)plane);
+        uint32_t width = plane == IVideoFrame::Y_PLANE ? videoFrame.width : (videoFrame.width + 1) / 2;
+        uint32_t height = plane == IVideoFrame::Y_PLANE ? videoFrame.height : (videoFrame.height + 1) / 2;
+        for (uint32_t row = 0; row < height; row += step)
+            hash = HashDjb2(data + row * videoFrame.stride[plane], width, hash);
+    }
+    return hash;
+}
+
+bool NodeVideoFrameTransporter::isDuplicateFrame(const IVideoFrame& videoFrame, FrameDedupState& state)
+{
+    uint32_t hash = sampleFrameHash(videoFrame, state.sampleStep);
+    auto now = std::chrono::steady_clock::now();
+    ++state.checkedFrames;
+    if (state.hasHash && hash == state.lastHash &&
+        now - state.lastDeliver < std::chrono::milliseconds(state.refreshInterval))
+    {
+        ++state.skippedFrames;
+        return true;
+    }
+    state.hasHash = true;
+    state.lastHash = hash;
+    state.lastDeliver = now;
+    return false;
+}
+
+static bool isTileChanged(const uint8_t* prev, const uint8_t* cur, int stride, int x, int y, int width, int height)
+{
+    for (int row = y; row < y + height; row++)
+    {
+        if (ComputeSumSquareError(prev + row * stride + x, cur + row * stride + x, width) != 0)
+            return true;
+    }
+    return false;
+}
+
+void NodeVideoFrameTransporter::updateDirtyTiles(VideoFrameInfo& info, int stride, int height)
+{
+    FrameDirtyTileState& state = info.m_tiles;
+    if (!state.hasPrevious || state.stride != stride || state.height != height)
+    {
+        // 首帧或布局变化：整帧标记为脏，下一次投递完整帧
+        state.stride = stride;
+        state.height = height;
+        state.columns = (stride + state.tileSize - 1) / state.tileSize;
+        state.rows = (height + state.tileSize - 1) / state.tileSize;
+        state.dirty.assign(state.columns * state.rows, 1);
+        state.hasPrevious = true;
+        state.needFull = true;
+        return;
+    }
+
+    int halfStride = stride / 2, halfHeight = height / 2;
+    const uint8_t* prevY = &state.previous[0] + sizeof(image_header_type);
+    const uint8_t* prevU = prevY + stride * height;
+    const uint8_t* prevV = prevU + halfStride * halfHeight;
+    const uint8_t* curY = info.m_bufferList[1].buffer;
+    const uint8_t* curU = info.m_bufferList[2].buffer;
+    const uint8_t* curV = info.m_bufferList[3].buffer;
+    int size = (int)state.tileSize;
+    for (uint32_t r = 0; r < state.rows; r++)
+    {
+        for (uint32_t c = 0; c < state.columns; c++)
+        {
+            uint8_t& dirty = state.dirty[r * state.columns + c];
+            // 已标记的块在投递前无需再比较
+            if (dirty)
+                continue;
+            int x = c * size, y = r * size;
+            int w = std::min(size, stride - x), h = std::min(size, height - y);
+            dirty = isTileChanged(prevY, curY, stride, x, y, w, h) ||
+                    isTileChanged(prevU, curU, halfStride, x / 2, y / 2, w / 2, h / 2) ||
+                    isTileChanged(prevV, curV, halfStride, x / 2, y / 2, w / 2, h / 2);
+        }
+    }
+}
+
 void NodeVideoFrameTransporter::setupFrameHeader(image_header_type*header, int stride, int width, int height)
 {
     int left = (stride - width) / 2;
@@ -161,25 +728,10 @@ void NodeVideoFrameTransporter::setupFrameHeader(image_header_type*header, int s
 void NodeVideoFrameTransporter::copyFrame(const IVideoFrame& videoFrame, VideoFrameInfo& info, int dest_stride, int src_stride, int width, int height)
 {
     int width2 = dest_stride / 2, heigh2 = height / 2;
-    int strideY = videoFrame.stride[IVideoFrame::Y_PLANE];
-    int strideU = videoFrame.stride[IVideoFrame::U_PLANE];
-    int strideV = videoFrame.stride[IVideoFrame::V_PLANE];
-
     unsigned char* y = &info.m_buffer[0] + sizeof(image_header_type);
     unsigned char* u = y + dest_stride * height;
     unsigned char* v = u + width2 * heigh2;
-    const unsigned char* planeY = videoFrame.buffer(IVideoFrame::Y_PLANE);
-    const unsigned char* planeU = videoFrame.buffer(IVideoFrame::U_PLANE);
-    const unsigned char* planeV = videoFrame.buffer(IVideoFrame::V_PLANE);
-
-    if (videoFrame.width == width && videoFrame.height == height)
-    {
-        copyAndCentreYuv(planeY, planeU, planeV, videoFrame.width, videoFrame.height, src_stride, y, u, v, dest_stride);
-    }
-    else
-    {
-        I420Scale(planeY, strideY, planeU, strideU, planeV, strideV, videoFrame.width, videoFrame.height, (uint8_t*)y, dest_stride, (uint8_t*)u, width2, (uint8_t*)v, width2, width, height, kFilterNone);
-    }
+    copyI420Frame(videoFrame, info.m_scale, m_scaleBudgetUs, dest_stride, src_stride, width, height, y, u, v);
 
     info.m_bufferList[0].buffer = &info.m_buffer[0];
     info.m_bufferList[0].length = sizeof(image_header_type);
@@ -194,45 +746,129 @@ void NodeVideoFrameTransporter::copyFrame(const IVideoFrame& videoFrame, VideoFr
     info.m_bufferList[3].length = width2 * heigh2;
 }
 
-void NodeVideoFrameTransporter::copyAndCentreYuv(const unsigned char* srcYPlane, const unsigned char* srcUPlane, const unsigned char* srcVPlane, int width, int height, int srcStride,
-unsigned char* dstYPlane, unsigned char* dstUPlane, unsigned char* dstVPlane, int dstStride)
+void NodeVideoFrameTransporter::scaleToTarget(const IVideoFrame& videoFrame, VideoFrameInfo& info, int width, int height, const uint8_t* planes[3], int strides[3])
 {
-    if (srcStride == width && dstStride == width)
-    {
-        memcpy(dstYPlane, srcYPlane, width * height);
-        memcpy(dstUPlane, srcUPlane, width * height / 4);
-        memcpy(dstVPlane, srcVPlane, width * height / 4);
+    planes[0] = videoFrame.buffer(IVideoFrame::Y_PLANE);
+    planes[1] = videoFrame.buffer(IVideoFrame::U_PLANE);
+    planes[2] = videoFrame.buffer(IVideoFrame::V_PLANE);
+    strides[0] = videoFrame.stride[IVideoFrame::Y_PLANE];
+    strides[1] = videoFrame.stride[IVideoFrame::U_PLANE];
+    strides[2] = videoFrame.stride[IVideoFrame::V_PLANE];
+    if (videoFrame.width == width && videoFrame.height == height)
         return;
-    }
 
-    int dstDiff = dstStride - width;
-    //RGB(0,0,0) to YUV(0,128,128)
-    memset(dstYPlane, 0, dstStride * height);
-    memset(dstUPlane, 128, dstStride * height / 4);
-    memset(dstVPlane, 128, dstStride * height / 4);
+    // 先在 I420 上缩放到目标尺寸，格式转换只处理缩放后的像素
+    int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    size_t scaleSize = width * height + halfWidth * halfHeight * 2;
+    if (info.m_scaleBuffer.size() < scaleSize)
+        info.m_scaleBuffer.resize(scaleSize);
+    uint8_t* y = &info.m_scaleBuffer[0];
+    uint8_t* u = y + width * height;
+    uint8_t* v = u + halfWidth * halfHeight;
+    FilterMode filter = (FilterMode)selectVideoScaleFilter(info.m_scale, videoFrame.width, videoFrame.height, width, height);
+    auto begin = std::chrono::steady_clock::now();
+    I420Scale(planes[0], strides[0], planes[1], strides[1], planes[2], strides[2], videoFrame.width, videoFrame.height, y, width, u, halfWidth, v, halfWidth, width, height, filter);
+    updateVideoScaleCost(info.m_scale, begin, m_scaleBudgetUs);
+    planes[0] = y;
+    planes[1] = u;
+    planes[2] = v;
+    strides[0] = width;
+    strides[1] = strides[2] = halfWidth;
+}
 
-    for (int i = 0; i < height; ++i)
-    {
-        memcpy(dstYPlane + (dstDiff >> 1), srcYPlane, width);
-        srcYPlane += srcStride;
-        dstYPlane += dstStride;
+void NodeVideoFrameTransporter::convertFrameToRGBA(const IVideoFrame& videoFrame, VideoFrameInfo& info, int width, int height)
+{
+    const uint8_t* planes[3];
+    int strides[3];
+    scaleToTarget(videoFrame, info, width, height, planes, strides);
 
-        if (i % 2 == 0)
-        {
-            memcpy(dstUPlane + (dstDiff >> 2), srcUPlane, width >> 1);
-            srcUPlane += srcStride >> 1;
-            dstUPlane += dstStride >> 1;
+    // libyuv 的 ABGR/ARGB 以小端 32 位命名，内存字节序分别为 RGBA/BGRA
+    unsigned char* rgba = &info.m_buffer[0] + sizeof(image_header_type);
+    if (info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_RGBA)
+        I420ToABGR(planes[0], strides[0], planes[1], strides[1], planes[2], strides[2], rgba, width * 4, width, height);
+    else
+        I420ToARGB(planes[0], strides[0], planes[1], strides[1], planes[2], strides[2], rgba, width * 4, width, height);
 
-            memcpy(dstVPlane + (dstDiff >> 2), srcVPlane, width >> 1);
-            srcVPlane += srcStride >> 1;
-            dstVPlane += dstStride >> 1;
-        }
+    info.m_bufferList[0].buffer = &info.m_buffer[0];
+    info.m_bufferList[0].length = sizeof(image_header_type);
+
+    info.m_bufferList[1].buffer = rgba;
+    info.m_bufferList[1].length = width * height * 4;
+
+    info.m_bufferList[2].buffer = rgba;
+    info.m_bufferList[2].length = 0;
+
+    info.m_bufferList[3].buffer = rgba;
+    info.m_bufferList[3].length = 0;
+}
+
+void NodeVideoFrameTransporter::convertFrameToNV12(const IVideoFrame& videoFrame, VideoFrameInfo& info, int width, int height)
+{
+    const uint8_t* planes[3];
+    int strides[3];
+    scaleToTarget(videoFrame, info, width, height, planes, strides);
+
+    // UV 交错存放，每行 width/2 个 UV 对，渲染时只需上传两张纹理
+    unsigned char* y = &info.m_buffer[0] + sizeof(image_header_type);
+    unsigned char* uv = y + width * height;
+    I420ToNV12(planes[0], strides[0], planes[1], strides[1], planes[2], strides[2], y, width, uv, width, width, height);
+
+    info.m_bufferList[0].buffer = &info.m_buffer[0];
+    info.m_bufferList[0].length = sizeof(image_header_type);
+
+    info.m_bufferList[1].buffer = y;
+    info.m_bufferList[1].length = width * height;
+
+    info.m_bufferList[2].buffer = uv;
+    info.m_bufferList[2].length = width * height / 2;
+
+    info.m_bufferList[3].buffer = uv;
+    info.m_bufferList[3].length = 0;
+}
+
+void NodeVideoFrameTransporter::probeQuality(NodeRenderType type, nertc::uid_t uid, const IVideoFrame& videoFrame, VideoFrameInfo& info, int stride, int width, int height)
+{
+    std::lock_guard<std::mutex> lck(m_probeLock);
+    auto it = m_qualityProbes.find(std::make_pair(type, uid));
+    if (it == m_qualityProbes.end())
+        return;
+
+    // 取投递前最后一份 I420 数据：I420 输出取居中后的画面，其他格式取格式转换前的缩放结果
+    const uint8_t* planes[3];
+    int strides[3];
+    if (info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_I420)
+    {
+        int diff = stride - width;
+        planes[0] = info.m_bufferList[1].buffer + (diff >> 1);
+        planes[1] = info.m_bufferList[2].buffer + (diff >> 2);
+        planes[2] = info.m_bufferList[3].buffer + (diff >> 2);
+        strides[0] = stride;
+        strides[1] = strides[2] = stride / 2;
+    }
+    else if (videoFrame.width != (uint32_t)width || videoFrame.height != (uint32_t)height)
+    {
+        int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+        planes[0] = &info.m_scaleBuffer[0];
+        planes[1] = planes[0] + width * height;
+        planes[2] = planes[1] + halfWidth * halfHeight;
+        strides[0] = width;
+        strides[1] = strides[2] = halfWidth;
     }
+    else
+    {
+        planes[0] = videoFrame.buffer(IVideoFrame::Y_PLANE);
+        planes[1] = videoFrame.buffer(IVideoFrame::U_PLANE);
+        planes[2] = videoFrame.buffer(IVideoFrame::V_PLANE);
+        strides[0] = videoFrame.stride[IVideoFrame::Y_PLANE];
+        strides[1] = videoFrame.stride[IVideoFrame::U_PLANE];
+        strides[2] = videoFrame.stride[IVideoFrame::V_PLANE];
+    }
+    it->second->pushFrame(videoFrame, planes, strides, width, height);
 }
 
 #define NODE_SET_OBJ_PROP_HEADER(obj, it) \
     { \
-        Local<Value> propName = String::NewFromUtf8(isolate, "header", NewStringType::kInternalized).ToLocalChecked(); \
+        Local<Value> propName = nim_napi_new_key(isolate, "header"); \
         Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, (it)->buffer, (it)->length); \
         v8::Maybe<bool> ret = obj->Set(isolate->GetCurrentContext(), propName, buff); \
         if(!ret.IsNothing()) { \
@@ -244,7 +880,7 @@ unsigned char* dstYPlane, unsigned char* dstUPlane, unsigned char* dstVPlane, in
 
 #define NODE_SET_OBJ_PROP_DATA(obj, name, it) \
     { \
-        Local<Value> propName = String::NewFromUtf8(isolate, name, NewStringType::kInternalized).ToLocalChecked(); \
+        Local<Value> propName = nim_napi_new_key(isolate, name); \
         Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, (it)->buffer, (it)->length); \
         Local<v8::Uint8Array> dataarray = v8::Uint8Array::New(buff, 0, it->length);\
         v8::Maybe<bool> ret = obj->Set(isolate->GetCurrentContext(), propName, dataarray); \
@@ -255,18 +891,112 @@ unsigned char* dstYPlane, unsigned char* dstUPlane, unsigned char* dstVPlane, in
         } \
     }
 
+// 返回 -1 表示自上次投递以来没有变化，0 表示投递完整帧，1 表示已将脏块打包到 planes
+static int packDirtyTiles(VideoFrameInfo& info, buffer_list& planes)
+{
+    FrameDirtyTileState& state = info.m_tiles;
+    auto now = std::chrono::steady_clock::now();
+    size_t count = std::count_if(state.dirty.begin(), state.dirty.end(), [](uint8_t d) { return d != 0; });
+    if (state.needFull || count * 2 > state.dirty.size() ||
+        now - state.lastFull >= std::chrono::milliseconds(state.refreshInterval))
+    {
+        state.needFull = false;
+        state.lastFull = now;
+        std::fill(state.dirty.begin(), state.dirty.end(), 0);
+        return 0;
+    }
+    if (count == 0)
+        return -1;
+
+    int stride = state.stride, height = state.height, size = (int)state.tileSize;
+    int halfStride = stride / 2;
+    size_t lumaSize = 0;
+    for (uint32_t r = 0; r < state.rows; r++)
+    {
+        for (uint32_t c = 0; c < state.columns; c++)
+        {
+            if (state.dirty[r * state.columns + c])
+                lumaSize += std::min(size, stride - (int)(c * size)) * std::min(size, height - (int)(r * size));
+        }
+    }
+    if (state.packed.size() < lumaSize * 3 / 2)
+        state.packed.resize(lumaSize * 3 / 2);
+
+    // 按块的行优先顺序依次存放，Y、U、V 各自连续
+    uint8_t* dstY = &state.packed[0];
+    uint8_t* dstU = dstY + lumaSize;
+    uint8_t* dstV = dstU + lumaSize / 4;
+    planes[0] = info.m_bufferList[0];
+    planes[1].buffer = dstY;
+    planes[1].length = (uint32_t)lumaSize;
+    planes[2].buffer = dstU;
+    planes[2].length = (uint32_t)(lumaSize / 4);
+    planes[3].buffer = dstV;
+    planes[3].length = (uint32_t)(lumaSize / 4);
+    for (uint32_t r = 0; r < state.rows; r++)
+    {
+        for (uint32_t c = 0; c < state.columns; c++)
+        {
+            if (!state.dirty[r * state.columns + c])
+                continue;
+            int x = c * size, y = r * size;
+            int w = std::min(size, stride - x), h = std::min(size, height - y);
+            CopyPlane(info.m_bufferList[1].buffer + y * stride + x, stride, dstY, w, w, h);
+            CopyPlane(info.m_bufferList[2].buffer + y / 2 * halfStride + x / 2, halfStride, dstU, w / 2, w / 2, h / 2);
+            CopyPlane(info.m_bufferList[3].buffer + y / 2 * halfStride + x / 2, halfStride, dstV, w / 2, w / 2, h / 2);
+            dstY += w * h;
+            dstU += (w / 2) * (h / 2);
+            dstV += (w / 2) * (h / 2);
+        }
+    }
+    return 1;
+}
+
 bool AddObj(Isolate* isolate, Local<v8::Array>& infos, int index, VideoFrameInfo& info)
 {
     if (!info.m_needUpdate)
         return false;
     info.m_needUpdate = false;
+    buffer_list tilePlanes;
+    int tileResult = 0;
+    if (info.m_tiles.enabled && info.m_outputFormat == NODE_VIDEO_OUTPUT_FORMAT_I420)
+    {
+        tileResult = packDirtyTiles(info, tilePlanes);
+        if (tileResult < 0)
+        {
+            ++info.m_stats.suppressedFrames;
+            return false;
+        }
+    }
     bool result = false;
     do {
         Local<v8::Object> obj = Object::New(isolate);
         nim_napi_set_object_value_uint32(isolate, obj, "type", info.m_renderType);
         nim_napi_set_object_value_uint64(isolate, obj, "uid", info.m_uid);
         nim_napi_set_object_value_utf8string(isolate, obj, "channelId", info.m_channelId);
-        auto it = info.m_bufferList.begin();
+        if (tileResult > 0)
+        {
+            // ydata/udata/vdata 中只有脏块数据，map 中按行优先每块一个字节
+            FrameDirtyTileState& state = info.m_tiles;
+            Local<v8::Object> tiles = Object::New(isolate);
+            nim_napi_set_object_value_uint32(isolate, tiles, "tileSize", state.tileSize);
+            nim_napi_set_object_value_uint32(isolate, tiles, "columns", state.columns);
+            nim_napi_set_object_value_uint32(isolate, tiles, "rows", state.rows);
+            Local<v8::ArrayBuffer> map = v8::ArrayBuffer::New(isolate, state.dirty.size());
+            memcpy(nim_napi_get_arraybuffer_data(map), state.dirty.data(), state.dirty.size());
+            tiles->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, "map"), v8::Uint8Array::New(map, 0, state.dirty.size()));
+            obj->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, "dirtyTiles"), tiles);
+            std::fill(state.dirty.begin(), state.dirty.end(), 0);
+        }
+        FrameLatencyState& latency = info.m_latency;
+        latency.lastArrival = latency.arrival;
+        latency.lastDeliver = NodeVideoFrameTransporter::monotonicMs();
+        ++info.m_stats.deliveredFrames;
+        info.m_stats.deliveredRate.tick(latency.lastDeliver);
+        if (latency.enabled && !info.m_visibility.redisplay)
+            latency.arriveToDeliver.add(latency.lastDeliver - latency.arrival);
+        info.m_visibility.redisplay = false;
+        auto it = tileResult > 0 ? tilePlanes.begin() : info.m_bufferList.begin();
         NODE_SET_OBJ_PROP_HEADER(obj, it);
         ++it;
         NODE_SET_OBJ_PROP_DATA(obj, "ydata", it);
@@ -274,11 +1004,81 @@ bool AddObj(Isolate* isolate, Local<v8::Array>& infos, int index, VideoFrameInfo
         NODE_SET_OBJ_PROP_DATA(obj, "udata", it);
         ++it;
         NODE_SET_OBJ_PROP_DATA(obj, "vdata", it);
+        if (!info.m_sei.empty())
+        {
+            Local<v8::Array> sei = v8::Array::New(isolate, (int)info.m_sei.lengths.size());
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < info.m_sei.lengths.size(); i++)
+            {
+                uint32_t length = info.m_sei.lengths[i];
+                Local<v8::ArrayBuffer> buff = v8::ArrayBuffer::New(isolate, length);
+                if (length > 0)
+                    memcpy(nim_napi_get_arraybuffer_data(buff), info.m_sei.data.data() + offset, length);
+                sei->Set(isolate->GetCurrentContext(), i, buff);
+                offset += length;
+            }
+            info.m_sei.clear();
+            obj->Set(isolate->GetCurrentContext(), nim_napi_new_key(isolate, "sei"), sei);
+        }
         result = infos->Set(isolate->GetCurrentContext(), index, obj).FromJust();
     } while (false);
     return result;
 }
 
+uint32_t NodeVideoFrameTransporter::drainVideoFrames(Isolate *isolate, const Local<Function> &cb, const Local<Value> &recv)
+{
+    std::lock_guard<std::mutex> frameLock(m_frameLock);
+    Local<v8::Array> infos = v8::Array::New(isolate);
+    uint32_t i = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        updateRenderGovernor();
+        for (auto& channel : m_remoteVideoFrames) {
+            for (auto& it : channel.second) {
+                if (AddObj(isolate, infos, i, it.second))
+                    ++i;
+                else {
+                    ++it.second.m_count;
+                }
+            }
+        }
+
+        if (m_localVideoFrame.get()) {
+            if (AddObj(isolate, infos, i, *m_localVideoFrame.get()))
+                ++i;
+            else {
+                ++m_localVideoFrame->m_count;
+            }
+        }
+
+        for (auto& channel : m_substreamVideoFrame) {
+            for (auto& it : channel.second) {
+                if (AddObj(isolate, infos, i, it.second))
+                    ++i;
+                else {
+                    ++it.second.m_count;
+                }
+            }
+        }
+
+        if (m_localSubStreamVideoFrame.get()) {
+            if (AddObj(isolate, infos, i, *m_localSubStreamVideoFrame.get()))
+                ++i;
+            else {
+                ++m_localSubStreamVideoFrame->m_count;
+            }
+        }
+    }
+
+    // 回调中会同步调用 reportVideoFrameRendered、setStreamVisibility 等获取 m_lock 的接口，
+    // 因此只保留 m_frameLock，视频回调线程在回调返回前不会改写帧缓冲
+    if (i > 0) {
+        Local<v8::Value> args[1] = { infos };
+        cb->Call(isolate->GetCurrentContext(), recv, 1, args);
+    }
+    return i;
+}
+
 void NodeVideoFrameTransporter::FlushVideo()
 {
     while (!m_stopFlag) {
@@ -286,46 +1086,7 @@ void NodeVideoFrameTransporter::FlushVideo()
             nim_node::node_async_call::async_call([this]() {
                 Isolate *isolate = env;
                 HandleScope scope(isolate);
-                std::lock_guard<std::mutex> lock(m_lock);
-                Local<v8::Array> infos = v8::Array::New(isolate);
-
-                uint32_t i = 0;
-                for (auto& it : m_remoteVideoFrames) {
-                    if (AddObj(isolate, infos, i, it.second))
-                        ++i;
-                    else {
-                        ++it.second.m_count;
-                    }
-                }
-
-                if (m_localVideoFrame.get()) {
-                    if (AddObj(isolate, infos, i, *m_localVideoFrame.get()))
-                        ++i;
-                    else {
-                        ++m_localVideoFrame->m_count;
-                    }
-                }
-
-                for (auto& it : m_substreamVideoFrame) {
-                    if (AddObj(isolate, infos, i, it.second))
-                        ++i;
-                    else {
-                        ++it.second.m_count;
-                    }
-                } 
-
-                if (m_localSubStreamVideoFrame.get()) {
-                    if (AddObj(isolate, infos, i, *m_localSubStreamVideoFrame.get()))
-                        ++i;
-                    else {
-                        ++m_localSubStreamVideoFrame->m_count;
-                    }
-                }
-
-                if (i > 0) {
-                    Local<v8::Value> args[1] = { infos };
-                    callback.Get(isolate)->Call(isolate->GetCurrentContext(), js_this.Get(isolate), 1, args);
-                }
+                drainVideoFrames(isolate, callback.Get(isolate), js_this.Get(isolate));
             });
             std::this_thread::sleep_for(std::chrono::milliseconds(1000 / m_FPS));
         }
@@ -379,15 +1140,15 @@ void NodeVideoFrameTransporter::onFrameDataCallback(
         frame.stride[i] = stride[i];
     }
 
-    frame.uid = *((nertc::uid_t *)user_data);
+    NodeVideoCanvasContext *context = static_cast<NodeVideoCanvasContext *>(user_data);
+    frame.uid = context->uid;
     frame.width = width;
     frame.height = height;
 
-    NodeRenderType nrt = frame.uid == 0 ? NODE_RENDER_TYPE_LOCAL : NODE_RENDER_TYPE_REMOTE;
     auto *pTransporter = getNodeVideoFrameTransporter();
     if (pTransporter)
     {
-        pTransporter->deliverFrame_I420(nrt, frame.uid, "", frame, rotate, frame.uid == 0);
+        pTransporter->deliverFrame_I420(*context, frame, rotate, frame.uid == 0);
     }
 }
 
@@ -438,15 +1199,15 @@ void NodeVideoFrameTransporter::onSubstreamFrameDataCallback(
         frame.stride[i] = stride[i];
     }
 
-    frame.uid = *((nertc::uid_t *)user_data);
+    NodeVideoCanvasContext *context = static_cast<NodeVideoCanvasContext *>(user_data);
+    frame.uid = context->uid;
     frame.width = width;
     frame.height = height;
 
-    NodeRenderType nrt = frame.uid == 0 ? NODE_RENDER_TYPE_LOCAL_SUBSTREAM : NODE_RENDER_TYPE_REMOTE_SUBSTREAM;
     auto *pTransporter = getNodeVideoFrameTransporter();
     if (pTransporter)
     {
-        pTransporter->deliverFrame_I420(nrt, frame.uid, "", frame, rotate, false);
+        pTransporter->deliverFrame_I420(*context, frame, rotate, false);
     }
 }
 }
\ No newline at end of file
@@ -10,7 +10,14 @@
 #include <atomic>
 #include <thread>
 #include <memory>
+#include <map>
+#include <tuple>
+#include <chrono>
 #include "nertc_engine_defines.h"
+#include "nertc_node_video_frame_sink.h"
+#include "nertc_node_video_quality_probe.h"
+#include "nertc_node_latency_histogram.h"
+#include "nertc_node_render_governor.h"
 using v8::Persistent;
 using v8::Context;
 using v8::Function;
@@ -98,7 +105,250 @@ namespace nertc_node
         NODE_RENDER_TYPE_REMOTE_SUBSTREAM
     };
 
+    // streamType: 0-主流 1-辅流，uid 为 0 表示本地
+    inline NodeRenderType getNodeRenderType(nertc::uid_t uid, uint32_t streamType)
+    {
+        if (streamType == 1)
+            return uid == 0 ? NODE_RENDER_TYPE_LOCAL_SUBSTREAM : NODE_RENDER_TYPE_REMOTE_SUBSTREAM;
+        return uid == 0 ? NODE_RENDER_TYPE_LOCAL : NODE_RENDER_TYPE_REMOTE;
+    }
+
+    // 投递给 JS 的帧格式，写入 image_header_type::format
+    enum NodeVideoOutputFormat
+    {
+        NODE_VIDEO_OUTPUT_FORMAT_I420 = 0,
+        NODE_VIDEO_OUTPUT_FORMAT_RGBA = 1,
+        NODE_VIDEO_OUTPUT_FORMAT_BGRA = 2,
+        NODE_VIDEO_OUTPUT_FORMAT_NV12 = 3,
+    };
+
+    // 渲染缩放使用的滤波档位，前四项与 libyuv::FilterMode 取值一致
+    enum NodeVideoScaleFilter
+    {
+        NODE_VIDEO_SCALE_FILTER_NONE = 0,
+        NODE_VIDEO_SCALE_FILTER_LINEAR = 1,
+        NODE_VIDEO_SCALE_FILTER_BILINEAR = 2,
+        NODE_VIDEO_SCALE_FILTER_BOX = 3,
+        NODE_VIDEO_SCALE_FILTER_AUTO = 4, // 按缩放比例选择，超出 CPU 预算时逐级降档
+    };
+
+#define SCALE_FILTER_DEFAULT_BUDGET_US 2000
+#define SCALE_FILTER_RETRY_FRAMES 300
+
+    // 自动档位的状态：ceiling 为当前允许的最高档位，超出预算时降低，
+    // 每 SCALE_FILTER_RETRY_FRAMES 帧尝试回升一档
+    struct FrameScaleState
+    {
+        NodeVideoScaleFilter mode;
+        NodeVideoScaleFilter ceiling;
+        NodeVideoScaleFilter current;
+        double costUs; // 当前档位单帧缩放耗时的滑动平均
+        uint32_t frames;
+
+        FrameScaleState()
+            : mode(NODE_VIDEO_SCALE_FILTER_AUTO), ceiling(NODE_VIDEO_SCALE_FILTER_BOX), current(NODE_VIDEO_SCALE_FILTER_NONE), costUs(0), frames(0)
+        {
+        }
+        void reset()
+        {
+            ceiling = NODE_VIDEO_SCALE_FILTER_BOX;
+            costUs = 0;
+            frames = 0;
+        }
+    };
+
 #define MAX_MISS_COUNT 500
+#define MAX_FRAME_SEI_COUNT 8
+
+    // 附加在视频帧上的 SEI 列表，data 中连续存放，lengths 为每条的长度
+    struct FrameSEIList
+    {
+        std::vector<char> data;
+        std::vector<uint32_t> lengths;
+
+        void append(const char *buf, uint32_t length)
+        {
+            // 超出上限时丢弃最早的一条，只保留最近的 SEI
+            if (lengths.size() >= MAX_FRAME_SEI_COUNT)
+            {
+                data.erase(data.begin(), data.begin() + lengths.front());
+                lengths.erase(lengths.begin());
+            }
+            data.insert(data.end(), buf, buf + length);
+            lengths.push_back(length);
+        }
+        void append(const FrameSEIList &other)
+        {
+            uint32_t offset = 0;
+            for (auto length : other.lengths)
+            {
+                append(other.data.data() + offset, length);
+                offset += length;
+            }
+        }
+        bool empty() const { return lengths.empty(); }
+        void clear()
+        {
+            data.clear();
+            lengths.clear();
+        }
+    };
+
+#define DEDUP_DEFAULT_SAMPLE_STEP 4
+#define DEDUP_DEFAULT_REFRESH_INTERVAL 1000
+
+    // 重复帧抑制：对源帧按行抽样计算哈希，与上一次投递的帧相同时跳过拷贝与投递
+    struct FrameDedupState
+    {
+        bool enabled;
+        uint32_t sampleStep;      // 每隔多少行取一行参与哈希，1 表示整帧
+        uint32_t refreshInterval; // ms，超过该时长即使内容未变也强制投递一次
+        bool hasHash;
+        uint32_t lastHash;
+        std::chrono::steady_clock::time_point lastDeliver;
+        uint64_t checkedFrames;
+        uint64_t skippedFrames;
+
+        FrameDedupState()
+            : enabled(false), sampleStep(DEDUP_DEFAULT_SAMPLE_STEP), refreshInterval(DEDUP_DEFAULT_REFRESH_INTERVAL), hasHash(false), lastHash(0), checkedFrames(0), skippedFrames(0)
+        {
+        }
+    };
+
+#define DIRTY_TILE_DEFAULT_SIZE 64
+#define DIRTY_TILE_DEFAULT_REFRESH_INTERVAL 2000
+
+    // 脏块投递：与上一帧逐块比较，投递时只打包自上次投递以来变化过的块，
+    // 变化超过一半、布局变化或到达刷新间隔时投递完整帧
+    struct FrameDirtyTileState
+    {
+        bool enabled;
+        uint32_t tileSize;
+        uint32_t refreshInterval; // ms
+        stream_buffer_type previous; // 上一帧完整数据，与 VideoFrameInfo::m_buffer 同布局
+        bool hasPrevious;
+        bool needFull;
+        int stride;
+        int height;
+        uint32_t columns;
+        uint32_t rows;
+        std::vector<uint8_t> dirty; // 每块一个字节，非 0 表示自上次投递以来有变化
+        stream_buffer_type packed;
+        std::chrono::steady_clock::time_point lastFull;
+
+        FrameDirtyTileState()
+            : enabled(false), tileSize(DIRTY_TILE_DEFAULT_SIZE), refreshInterval(DIRTY_TILE_DEFAULT_REFRESH_INTERVAL), hasPrevious(false), needFull(true), stride(0), height(0), columns(0), rows(0)
+        {
+        }
+        void reset()
+        {
+            hasPrevious = false;
+            needFull = true;
+        }
+    };
+
+    // 时间均为单调时钟的毫秒值（截断为 32 位），到达时间同时写入 image_header_type::timestamp
+    struct FrameLatencyState
+    {
+        bool enabled;
+        uint32_t arrival;     // 当前缓存帧的到达时间
+        uint32_t lastArrival; // 最近一次投递的帧的到达时间
+        uint32_t lastDeliver; // 最近一次投递的时间
+        NodeLatencyHistogram arriveToDeliver;
+        NodeLatencyHistogram deliverToRender;
+        NodeLatencyHistogram arriveToRender;
+
+        FrameLatencyState()
+            : enabled(false), arrival(0), lastArrival(0), lastDeliver(0)
+        {
+        }
+        void reset()
+        {
+            arriveToDeliver.reset();
+            deliverToRender.reset();
+            arriveToRender.reset();
+        }
+    };
+
+    // 按 1 秒窗口统计帧率，窗口内无帧超过 2 秒时视为 0
+    struct FrameRateCounter
+    {
+        uint32_t windowStart;
+        uint32_t windowCount;
+        double rate;
+
+        FrameRateCounter() : windowStart(0), windowCount(0), rate(0) {}
+        void tick(uint32_t nowMs)
+        {
+            ++windowCount;
+            uint32_t elapsed = nowMs - windowStart;
+            if (elapsed >= 1000)
+            {
+                rate = windowStart ? windowCount * 1000.0 / elapsed : 0;
+                windowStart = nowMs;
+                windowCount = 0;
+            }
+        }
+        double current(uint32_t nowMs) const { return nowMs - windowStart > 2000 ? 0 : rate; }
+    };
+
+    // 单路视频流在 native 投递链路上的计数
+    struct FrameTransportStats
+    {
+        uint64_t receivedFrames;   // SDK 回调的帧数
+        uint64_t suppressedFrames; // 重复帧抑制或脏块无变化而未投递的帧数
+        uint64_t copiedFrames;     // 拷贝/转换进投递缓冲的帧数
+        uint64_t scaledFrames;     // 其中需要缩放的帧数
+        uint64_t coalescedFrames;  // 投递前被新帧覆盖而丢弃的帧数
+        uint64_t deliveredFrames;  // 实际投递给 JS 的帧数
+        uint64_t throttledFrames;  // 被渲染频率调控跳过的帧数
+        uint64_t hiddenFrames;     // 流不可见而跳过的帧数
+        uint64_t copiedBytes;
+        uint64_t copyTimeUs;
+        FrameRateCounter receivedRate;
+        FrameRateCounter deliveredRate;
+
+        FrameTransportStats()
+            : receivedFrames(0), suppressedFrames(0), copiedFrames(0), scaledFrames(0), coalescedFrames(0), deliveredFrames(0), throttledFrames(0), hiddenFrames(0), copiedBytes(0), copyTimeUs(0)
+        {
+        }
+    };
+
+    // 渲染频率调控：targetFps 由 updateRenderGovernor 按优先级与全局预算分配，0 表示不限
+    struct FrameGovernorState
+    {
+        NodeStreamPriority priority;
+        double targetFps;
+        uint32_t lastAccept; // 最近一次接受的帧的到达时间（ms）
+        uint32_t pixels;     // 最近一帧的投递分辨率
+
+        FrameGovernorState()
+            : priority(NODE_STREAM_PRIORITY_VISIBLE), targetFps(0), lastAccept(0), pixels(0)
+        {
+        }
+    };
+
+#define THUMBNAIL_DEFAULT_SCALE 4
+
+    // 不可见的流跳过拷贝与投递，m_buffer 中保留最后一帧，重新可见时立即补投。
+    // thumbnailInterval 非 0 时仍按该间隔（ms）投递 1/thumbnailScale 尺寸的缩略帧，
+    // 缩略帧写入 m_buffer 前先把最后一帧完整画面换到 fullFrame 中，重新可见时换回补投
+    struct FrameVisibilityState
+    {
+        bool visible;
+        uint32_t thumbnailInterval;
+        uint32_t thumbnailScale;
+        uint32_t lastThumbnail;
+        bool redisplay; // 待投递的是重新可见时补投的旧帧，不计入到达至投递的时延
+        bool hasFullFrame;
+        stream_buffer_type fullFrame;
+        buffer_list fullFramePlanes; // 指向 fullFrame 内部，vector 交换后仍然有效
+
+        FrameVisibilityState()
+            : visible(true), thumbnailInterval(0), thumbnailScale(THUMBNAIL_DEFAULT_SCALE), lastThumbnail(0), redisplay(false), hasFullFrame(false)
+        {
+        }
+    };
 
     class VideoFrameInfo
     {
@@ -112,20 +362,44 @@ namespace nertc_node
         bool m_needUpdate;
         uint32_t m_count;
         std::string m_channelId;
+        FrameSEIList m_sei;
+        NodeVideoOutputFormat m_outputFormat;
+        stream_buffer_type m_scaleBuffer;
+        FrameDedupState m_dedup;
+        FrameDirtyTileState m_tiles;
+        FrameScaleState m_scale;
+        FrameLatencyState m_latency;
+        FrameTransportStats m_stats;
+        FrameGovernorState m_governor;
+        FrameVisibilityState m_visibility;
         VideoFrameInfo()
-            : m_renderType(NODE_RENDER_TYPE_REMOTE), m_uid(0), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId("")
+            : m_renderType(NODE_RENDER_TYPE_REMOTE), m_uid(0), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId(""), m_outputFormat(NODE_VIDEO_OUTPUT_FORMAT_I420)
         {
         }
         VideoFrameInfo(NodeRenderType type)
-            : m_renderType(type), m_uid(0), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId("")
+            : m_renderType(type), m_uid(0), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId(""), m_outputFormat(NODE_VIDEO_OUTPUT_FORMAT_I420)
         {
         }
-        VideoFrameInfo(NodeRenderType type, nertc::uid_t uid, std::string channelId)
-            : m_renderType(type), m_uid(uid), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId(channelId)
+        VideoFrameInfo(NodeRenderType type, nertc::uid_t uid, const std::string &channelId)
+            : m_renderType(type), m_uid(uid), m_destWidth(0), m_destHeight(0), m_needUpdate(false), m_count(0), m_channelId(channelId), m_outputFormat(NODE_VIDEO_OUTPUT_FORMAT_I420)
         {
         }
     };
 
+    // 远端视频流按频道分组，频道内按 uid 索引。空频道名对应引擎自身加入的频道
+    typedef std::unordered_map<nertc::uid_t, VideoFrameInfo> VideoFrameMap;
+    typedef std::unordered_map<std::string, VideoFrameMap> ChannelVideoFrameMap;
+
+    // 画布回调的 user_data，每路流一份，由传输器持有，重复绑定画布时复用同一对象。
+    // info 在创建时即指向该流的帧状态（目标尺寸、统计等），帧回调中不再查表也不再分配
+    struct NodeVideoCanvasContext
+    {
+        NodeRenderType renderType;
+        nertc::uid_t uid;
+        std::string channelId;
+        VideoFrameInfo *info;
+    };
+
     class NodeVideoFrameTransporter
     {
     public:
@@ -134,8 +408,54 @@ namespace nertc_node
 
         void setLocalVideoMirrorMode(uint32_t mirrorMode) { m_localVideoMirrorMode = mirrorMode; }
         bool initialize(Isolate *isolate, const v8::FunctionCallbackInfo<Value> &callbackinfo);
-        int deliverFrame_I420(NodeRenderType type, nertc::uid_t uid, std::string channelId, const IVideoFrame &videoFrame, int rotation, bool mirrored);
-        int setVideoDimension(NodeRenderType, nertc::uid_t uid, std::string channelId, uint32_t width, uint32_t height);
+        // 开始接收帧但不启动投递线程，由调用方在 JS 线程中调用 drainVideoFrames 取帧
+        bool initializeManualDrain(Isolate *isolate);
+        // 在 JS 线程中把有新帧的流组装为数组并回调，返回投递的帧数
+        uint32_t drainVideoFrames(Isolate *isolate, const Local<Function> &cb, const Local<Value> &recv);
+        int deliverFrame_I420(NodeRenderType type, nertc::uid_t uid, const std::string &channelId, const IVideoFrame &videoFrame, int rotation, bool mirrored);
+        int deliverFrame_I420(NodeVideoCanvasContext &context, const IVideoFrame &videoFrame, int rotation, bool mirrored);
+        // 取得该路流的画布上下文，不存在时创建；返回值在 releaseVideoCanvasContexts 之前一直有效
+        NodeVideoCanvasContext *getVideoCanvasContext(NodeRenderType type, nertc::uid_t uid, const std::string &channelId);
+        // 引擎销毁后调用，此时已不会再有帧回调
+        void releaseVideoCanvasContexts();
+        int setVideoDimension(NodeRenderType, nertc::uid_t uid, const std::string &channelId, uint32_t width, uint32_t height);
+        // 引擎加入的频道名，投递给 JS 的帧与统计中以此标记引擎频道的视频流
+        void setChannelName(const std::string &channelName);
+        int setVideoOutputFormat(NodeRenderType type, nertc::uid_t uid, NodeVideoOutputFormat format);
+        int setDuplicateFrameSuppression(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t sampleStep, uint32_t refreshInterval);
+        void getDuplicateFrameStats(NodeRenderType type, nertc::uid_t uid, uint64_t &checkedFrames, uint64_t &skippedFrames);
+        int setDirtyTileDelivery(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t tileSize, uint32_t refreshInterval);
+        int setVideoScaleFilter(NodeRenderType type, nertc::uid_t uid, NodeVideoScaleFilter filter);
+        void setVideoScaleBudget(uint32_t budgetUs) { m_scaleBudgetUs = budgetUs; }
+        void setLatencyStats(bool enable);
+        int setStreamPriority(NodeRenderType type, nertc::uid_t uid, NodeStreamPriority priority);
+        void setRenderPixelBudget(uint64_t pixelsPerSecond);
+        int setStreamVisibility(NodeRenderType type, nertc::uid_t uid, bool visible, uint32_t thumbnailInterval, uint32_t thumbnailScale);
+        void onVideoFrameRendered(NodeRenderType type, nertc::uid_t uid, uint32_t timestamp);
+        void getLatencyStats(NodeRenderType type, nertc::uid_t uid, NodeLatencyHistogram &arriveToDeliver, NodeLatencyHistogram &deliverToRender, NodeLatencyHistogram &arriveToRender);
+        static uint32_t monotonicMs();
+        // 遍历所有视频流，在持有内部锁的情况下回调
+        template <typename Fn>
+        void forEachVideoFrameInfo(Fn fn)
+        {
+            std::lock_guard<std::mutex> lck(m_lock);
+            for (auto &channel : m_remoteVideoFrames)
+                for (auto &it : channel.second)
+                    fn(it.second);
+            for (auto &channel : m_substreamVideoFrame)
+                for (auto &it : channel.second)
+                    fn(it.second);
+            if (m_localVideoFrame.get())
+                fn(*m_localVideoFrame.get());
+            if (m_localSubStreamVideoFrame.get())
+                fn(*m_localSubStreamVideoFrame.get());
+        }
+        int startVideoFrameDump(NodeRenderType type, nertc::uid_t uid, const std::string &path, NodeVideoSinkFormat format);
+        int stopVideoFrameDump(NodeRenderType type, nertc::uid_t uid);
+        int setVideoQualityProbe(NodeRenderType type, nertc::uid_t uid, bool enable, uint32_t interval, NodeQualityReference reference);
+        bool getVideoQualityProbeStats(NodeRenderType type, nertc::uid_t uid, NodeQualityProbeStats &stats);
+        void setAttachSEIToFrame(bool enable);
+        void onSEIMessage(nertc::uid_t uid, const char *data, uint32_t length);
         static void onFrameDataCallback(
             nertc::uid_t uid,
             void *data,
@@ -184,28 +504,54 @@ namespace nertc_node
             uint16_t rotation;
             uint32_t timestamp;
         };
-        VideoFrameInfo &getVideoFrameInfo(NodeRenderType type, nertc::uid_t uid, std::string channelId);
+        VideoFrameInfo &getVideoFrameInfo(NodeRenderType type, nertc::uid_t uid, const std::string &channelId);
+        VideoFrameInfo &getChannelVideoFrameInfo(ChannelVideoFrameMap &frames, NodeRenderType type, nertc::uid_t uid, const std::string &channelId);
+        void pushFrameToSink(NodeRenderType type, nertc::uid_t uid, const IVideoFrame &videoFrame);
+        int deliverFrameLocked(VideoFrameInfo &info, bool engineChannel, uint32_t arrival, const IVideoFrame &videoFrame, int rotation, bool mirrored);
         bool deinitialize();
+        bool isDuplicateFrame(const IVideoFrame &videoFrame, FrameDedupState &state);
+        void updateDirtyTiles(VideoFrameInfo &info, int stride, int height);
         void setupFrameHeader(image_header_type *header, int stride, int width, int height);
         void copyFrame(const IVideoFrame &videoFrame, VideoFrameInfo &info, int dest_stride, int src_stride, int width, int height);
-        void copyAndCentreYuv(const unsigned char *srcYPlane, const unsigned char *srcUPlane, const unsigned char *srcVPlane, int width, int height, int srcStride,
-                              unsigned char *dstYPlane, unsigned char *dstUPlane, unsigned char *dstVPlane, int dstStride);
+        void scaleToTarget(const IVideoFrame &videoFrame, VideoFrameInfo &info, int width, int height, const uint8_t *planes[3], int strides[3]);
+        void convertFrameToRGBA(const IVideoFrame &videoFrame, VideoFrameInfo &info, int width, int height);
+        void convertFrameToNV12(const IVideoFrame &videoFrame, VideoFrameInfo &info, int width, int height);
+        void probeQuality(NodeRenderType type, nertc::uid_t uid, const IVideoFrame &videoFrame, VideoFrameInfo &info, int stride, int width, int height);
         void FlushVideo();
+        void updateRenderGovernor();
 
     private:
         bool init;
         Isolate *env;
         Persistent<Function> callback;
         Persistent<Object> js_this;
-        std::unordered_map<nertc::uid_t, VideoFrameInfo> m_remoteVideoFrames;
+        ChannelVideoFrameMap m_remoteVideoFrames;
         std::unique_ptr<VideoFrameInfo> m_localVideoFrame;
-        std::unordered_map<nertc::uid_t, VideoFrameInfo> m_substreamVideoFrame;
+        ChannelVideoFrameMap m_substreamVideoFrame;
         std::unique_ptr<VideoFrameInfo> m_localSubStreamVideoFrame;
         std::mutex m_lock;
+        // 投递给 JS 的帧缓冲以外部 ArrayBuffer 引用，回调期间持有，先于 m_lock 获取
+        std::mutex m_frameLock;
         int m_stopFlag;
         std::unique_ptr<std::thread> m_thread;
         uint32_t m_FPS;
         uint32_t m_localVideoMirrorMode = 0; //0-auto 1-mirror 2-unmirror
+        std::mutex m_sinkLock;
+        std::atomic<uint32_t> m_sinkCount;
+        // 视频回调取出引用后在锁外拷贝，停止时由调用方先 stop，最后一个引用可能在视频回调线程释放
+        std::map<std::pair<NodeRenderType, nertc::uid_t>, std::shared_ptr<NodeVideoFrameSink>> m_frameSinks;
+        std::mutex m_probeLock;
+        std::atomic<uint32_t> m_probeCount;
+        std::map<std::pair<NodeRenderType, nertc::uid_t>, std::unique_ptr<NodeVideoQualityProbe>> m_qualityProbes;
+        std::atomic<uint32_t> m_scaleBudgetUs;
+        std::atomic<bool> m_latencyStats;
+        std::atomic<uint64_t> m_pixelBudget;
+        uint32_t m_governorUpdate;
+        std::atomic<bool> m_attachSEI;
+        std::unordered_map<nertc::uid_t, FrameSEIList> m_pendingSEI; // 只对应引擎频道
+        std::string m_channelName;
+        // 帧状态只增不删，info 指针在容器扩容后仍然有效
+        std::map<std::tuple<NodeRenderType, std::string, nertc::uid_t>, std::unique_ptr<NodeVideoCanvasContext>> m_canvasContexts;
     };
 
     NodeVideoFrameTransporter *getNodeVideoFrameTransporter();
@@ -0,0 +1,178 @@
+#include "nertc_node_video_frame_sink.h"
+#include "nertc_node_video_frame_provider.h"
+#include "libyuv.h"
+#ifdef WIN32
+#include "../shared/util/string_util.h"
+#endif
+
+namespace nertc_node
+{
+NodeVideoFrameSink::NodeVideoFrameSink(const std::string &path, NodeVideoSinkFormat format)
+: m_path(path)
+, m_format(format)
+, m_file(nullptr)
+, m_fileWidth(0)
+, m_fileHeight(0)
+, m_segment(0)
+, m_stopFlag(false)
+, m_writtenFrames(0)
+, m_droppedFrames(0)
+{
+}
+
+NodeVideoFrameSink::~NodeVideoFrameSink()
+{
+    stop();
+}
+
+bool NodeVideoFrameSink::start()
+{
+    if (m_thread.get())
+        return true;
+    // 在调用线程中打开第一个文件，路径不可写时直接返回失败，而不是在写线程中把每一帧都计为丢弃
+    if (!m_file && !openSegment())
+        return false;
+    m_stopFlag = false;
+    m_thread.reset(new std::thread(&NodeVideoFrameSink::writeLoop, this));
+    return true;
+}
+
+void NodeVideoFrameSink::stop()
+{
+    if (!m_thread.get())
+        return;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_stopFlag = true;
+    }
+    m_cond.notify_one();
+    if (m_thread->joinable())
+        m_thread->join();
+    m_thread.reset();
+    closeSegment();
+}
+
+void NodeVideoFrameSink::pushFrame(const IVideoFrame &videoFrame)
+{
+    int width = videoFrame.width, height = videoFrame.height;
+    int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    size_t frameSize = width * height + halfWidth * halfHeight * 2;
+
+    std::unique_ptr<SinkFrame> frame;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        if (m_stopFlag || m_queue.size() >= VIDEO_SINK_MAX_QUEUE_FRAMES) {
+            ++m_droppedFrames;
+            return;
+        }
+        if (!m_freeList.empty()) {
+            frame = std::move(m_freeList.back());
+            m_freeList.pop_back();
+        }
+    }
+    if (!frame.get())
+        frame.reset(new SinkFrame());
+    frame->width = width;
+    frame->height = height;
+    if (frame->data.size() != frameSize)
+        frame->data.resize(frameSize);
+
+    uint8_t *y = &frame->data[0];
+    uint8_t *u = y + width * height;
+    uint8_t *v = u + halfWidth * halfHeight;
+    libyuv::I420Copy(videoFrame.buffer(IVideoFrame::Y_PLANE), videoFrame.stride[IVideoFrame::Y_PLANE],
+                     videoFrame.buffer(IVideoFrame::U_PLANE), videoFrame.stride[IVideoFrame::U_PLANE],
+                     videoFrame.buffer(IVideoFrame::V_PLANE), videoFrame.stride[IVideoFrame::V_PLANE],
+                     y, width, u, halfWidth, v, halfWidth, width, height);
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_queue.push_back(std::move(frame));
+    }
+    m_cond.notify_one();
+}
+
+void NodeVideoFrameSink::writeLoop()
+{
+    while (true) {
+        std::unique_ptr<SinkFrame> frame;
+        {
+            std::unique_lock<std::mutex> lck(m_lock);
+            m_cond.wait(lck, [this]() { return m_stopFlag || !m_queue.empty(); });
+            if (m_queue.empty())
+                break;
+            frame = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // 分辨率变化时另起一个文件，保证每个文件内的帧尺寸一致；尺寸在写入第一帧时确定
+        if (m_file && m_fileWidth != 0 && (frame->width != m_fileWidth || frame->height != m_fileHeight))
+            closeSegment();
+        if (!m_file)
+            openSegment();
+        if (m_file && m_fileWidth == 0)
+            beginSegment(frame->width, frame->height);
+        if (m_file) {
+            bool ok = true;
+            if (m_format == NODE_VIDEO_SINK_FORMAT_Y4M)
+                ok = fwrite("FRAME\n", 1, 6, m_file) == 6;
+            ok = ok && fwrite(&frame->data[0], 1, frame->data.size(), m_file) == frame->data.size();
+            if (ok)
+                ++m_writtenFrames;
+            else
+                ++m_droppedFrames;
+        } else {
+            ++m_droppedFrames;
+        }
+
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_freeList.push_back(std::move(frame));
+    }
+}
+
+std::string NodeVideoFrameSink::segmentPath() const
+{
+    if (m_segment == 0)
+        return m_path;
+    std::string suffix = "_" + std::to_string(m_segment);
+    size_t dot = m_path.find_last_of('.');
+    size_t slash = m_path.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return m_path + suffix;
+    return m_path.substr(0, dot) + suffix + m_path.substr(dot);
+}
+
+bool NodeVideoFrameSink::openSegment()
+{
+    std::string path = segmentPath();
+    ++m_segment;
+#ifdef WIN32
+    m_file = _wfopen(UTF8ToUTF16(path).c_str(), L"wb");
+#else
+    m_file = fopen(path.c_str(), "wb");
+#endif
+    return m_file != nullptr;
+}
+
+void NodeVideoFrameSink::beginSegment(uint32_t width, uint32_t height)
+{
+    m_fileWidth = width;
+    m_fileHeight = height;
+    if (m_format == NODE_VIDEO_SINK_FORMAT_Y4M) {
+        // 回调中无法得知真实帧率，这里按 30fps 写入，播放时可通过 -r 覆盖
+        char header[128] = {0};
+        int len = snprintf(header, sizeof(header), "YUV4MPEG2 W%u H%u F30:1 Ip A1:1 C420jpeg\n", width, height);
+        fwrite(header, 1, len, m_file);
+    }
+}
+
+void NodeVideoFrameSink::closeSegment()
+{
+    if (m_file) {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+    m_fileWidth = 0;
+    m_fileHeight = 0;
+}
+
+} // namespace nertc_node
@@ -0,0 +1,80 @@
+#ifndef NERTC_NODE_VIDEO_FRAME_SINK_H
+#define NERTC_NODE_VIDEO_FRAME_SINK_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <condition_variable>
+
+namespace nertc_node
+{
+    struct IVideoFrame;
+
+    enum NodeVideoSinkFormat
+    {
+        NODE_VIDEO_SINK_FORMAT_I420 = 0, // 裸 I420 数据，逐帧紧密排列
+        NODE_VIDEO_SINK_FORMAT_Y4M = 1   // YUV4MPEG2 容器
+    };
+
+#define VIDEO_SINK_MAX_QUEUE_FRAMES 16
+
+    // 将视频帧以原始分辨率写入本地文件，写文件在独立线程中进行，
+    // 队列满时直接丢帧，不阻塞 SDK 的视频回调线程。
+    class NodeVideoFrameSink
+    {
+    public:
+        NodeVideoFrameSink(const std::string &path, NodeVideoSinkFormat format);
+        ~NodeVideoFrameSink();
+
+        // 打开第一个文件并启动写线程，文件无法创建时返回 false
+        bool start();
+        void stop();
+        // 在视频回调线程中调用，仅做一次紧密拷贝
+        void pushFrame(const IVideoFrame &videoFrame);
+
+        uint64_t writtenFrames() const { return m_writtenFrames; }
+        uint64_t droppedFrames() const { return m_droppedFrames; }
+
+    private:
+        struct SinkFrame
+        {
+            uint32_t width;
+            uint32_t height;
+            std::vector<uint8_t> data;
+        };
+
+        void writeLoop();
+        bool openSegment();
+        // 按第一帧的尺寸写入文件头
+        void beginSegment(uint32_t width, uint32_t height);
+        void closeSegment();
+        std::string segmentPath() const;
+
+    private:
+        std::string m_path;
+        NodeVideoSinkFormat m_format;
+        FILE *m_file;
+        uint32_t m_fileWidth;
+        uint32_t m_fileHeight;
+        uint32_t m_segment;
+
+        std::mutex m_lock;
+        std::condition_variable m_cond;
+        std::deque<std::unique_ptr<SinkFrame>> m_queue;
+        std::vector<std::unique_ptr<SinkFrame>> m_freeList;
+        bool m_stopFlag;
+        std::unique_ptr<std::thread> m_thread;
+
+        std::atomic<uint64_t> m_writtenFrames;
+        std::atomic<uint64_t> m_droppedFrames;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_VIDEO_FRAME_SINK_H
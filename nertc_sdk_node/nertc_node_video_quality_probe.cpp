@@ -0,0 +1,180 @@
+#include "nertc_node_video_quality_probe.h"
+#include "nertc_node_video_frame_provider.h"
+#include "libyuv.h"
+
+namespace nertc_node
+{
+static size_t i420Size(int width, int height)
+{
+    int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    return width * height + halfWidth * halfHeight * 2;
+}
+
+NodeVideoQualityProbe::NodeVideoQualityProbe(uint32_t interval, NodeQualityReference reference)
+: m_interval(interval > 0 ? interval : QUALITY_PROBE_DEFAULT_INTERVAL)
+, m_reference(reference)
+, m_frameCount(0)
+, m_stopFlag(false)
+{
+    m_stats = NodeQualityProbeStats();
+    m_thread.reset(new std::thread(&NodeVideoQualityProbe::probeLoop, this));
+}
+
+NodeVideoQualityProbe::~NodeVideoQualityProbe()
+{
+    stop();
+}
+
+void NodeVideoQualityProbe::stop()
+{
+    if (!m_thread.get())
+        return;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_stopFlag = true;
+    }
+    m_cond.notify_one();
+    if (m_thread->joinable())
+        m_thread->join();
+    m_thread.reset();
+}
+
+void NodeVideoQualityProbe::pushFrame(const IVideoFrame &source, const uint8_t *planes[3], const int strides[3], int width, int height)
+{
+    if (m_frameCount++ % m_interval != 0)
+        return;
+
+    std::unique_ptr<ProbeSample> sample;
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        if (m_stopFlag || m_queue.size() >= QUALITY_PROBE_MAX_QUEUE) {
+            ++m_stats.dropped;
+            return;
+        }
+        if (!m_freeList.empty()) {
+            sample = std::move(m_freeList.back());
+            m_freeList.pop_back();
+        }
+    }
+    if (!sample.get())
+        sample.reset(new ProbeSample());
+
+    int srcWidth = source.width, srcHeight = source.height;
+    int srcHalfWidth = (srcWidth + 1) / 2, srcHalfHeight = (srcHeight + 1) / 2;
+    int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    sample->sourceWidth = srcWidth;
+    sample->sourceHeight = srcHeight;
+    sample->width = width;
+    sample->height = height;
+    sample->source.resize(i420Size(srcWidth, srcHeight));
+    sample->delivered.resize(i420Size(width, height));
+
+    uint8_t *y = &sample->source[0];
+    uint8_t *u = y + srcWidth * srcHeight;
+    uint8_t *v = u + srcHalfWidth * srcHalfHeight;
+    libyuv::I420Copy(source.buffer(IVideoFrame::Y_PLANE), source.stride[IVideoFrame::Y_PLANE],
+                     source.buffer(IVideoFrame::U_PLANE), source.stride[IVideoFrame::U_PLANE],
+                     source.buffer(IVideoFrame::V_PLANE), source.stride[IVideoFrame::V_PLANE],
+                     y, srcWidth, u, srcHalfWidth, v, srcHalfWidth, srcWidth, srcHeight);
+    y = &sample->delivered[0];
+    u = y + width * height;
+    v = u + halfWidth * halfHeight;
+    libyuv::I420Copy(planes[0], strides[0], planes[1], strides[1], planes[2], strides[2],
+                     y, width, u, halfWidth, v, halfWidth, width, height);
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_queue.push_back(std::move(sample));
+    }
+    m_cond.notify_one();
+}
+
+void NodeVideoQualityProbe::measure(ProbeSample &sample, double &psnr, double &ssim)
+{
+    // a 为参考帧，b 为被评估的帧，两者分辨率一致
+    int width, height;
+    const uint8_t *a, *b;
+    if (m_reference == NODE_QUALITY_REFERENCE_BOX) {
+        width = sample.width;
+        height = sample.height;
+        sample.reference.resize(i420Size(width, height));
+        int srcHalfWidth = (sample.sourceWidth + 1) / 2, srcHalfHeight = (sample.sourceHeight + 1) / 2;
+        int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+        const uint8_t *sy = &sample.source[0];
+        const uint8_t *su = sy + sample.sourceWidth * sample.sourceHeight;
+        const uint8_t *sv = su + srcHalfWidth * srcHalfHeight;
+        uint8_t *y = &sample.reference[0];
+        uint8_t *u = y + width * height;
+        uint8_t *v = u + halfWidth * halfHeight;
+        libyuv::I420Scale(sy, sample.sourceWidth, su, srcHalfWidth, sv, srcHalfWidth, sample.sourceWidth, sample.sourceHeight,
+                          y, width, u, halfWidth, v, halfWidth, width, height, libyuv::kFilterBox);
+        a = &sample.reference[0];
+        b = &sample.delivered[0];
+    } else {
+        width = sample.sourceWidth;
+        height = sample.sourceHeight;
+        sample.reference.resize(i420Size(width, height));
+        int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+        int dstHalfWidth = (sample.width + 1) / 2, dstHalfHeight = (sample.height + 1) / 2;
+        const uint8_t *dy = &sample.delivered[0];
+        const uint8_t *du = dy + sample.width * sample.height;
+        const uint8_t *dv = du + dstHalfWidth * dstHalfHeight;
+        uint8_t *y = &sample.reference[0];
+        uint8_t *u = y + width * height;
+        uint8_t *v = u + halfWidth * halfHeight;
+        // 用双线性放大回源分辨率，尽量不引入额外的放大失真
+        libyuv::I420Scale(dy, sample.width, du, dstHalfWidth, dv, dstHalfWidth, sample.width, sample.height,
+                          y, width, u, halfWidth, v, halfWidth, width, height, libyuv::kFilterBilinear);
+        a = &sample.source[0];
+        b = &sample.reference[0];
+    }
+    int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    const uint8_t *au = a + width * height, *av = au + halfWidth * halfHeight;
+    const uint8_t *bu = b + width * height, *bv = bu + halfWidth * halfHeight;
+    psnr = libyuv::I420Psnr(a, width, au, halfWidth, av, halfWidth, b, width, bu, halfWidth, bv, halfWidth, width, height);
+    ssim = libyuv::I420Ssim(a, width, au, halfWidth, av, halfWidth, b, width, bu, halfWidth, bv, halfWidth, width, height);
+}
+
+void NodeVideoQualityProbe::probeLoop()
+{
+    while (true) {
+        std::unique_ptr<ProbeSample> sample;
+        {
+            std::unique_lock<std::mutex> lck(m_lock);
+            m_cond.wait(lck, [this]() { return m_stopFlag || !m_queue.empty(); });
+            if (m_stopFlag)
+                break;
+            sample = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        double psnr = 0, ssim = 0;
+        measure(*sample, psnr, ssim);
+
+        std::lock_guard<std::mutex> lck(m_lock);
+        m_window.push_back(std::make_pair(psnr, ssim));
+        if (m_window.size() > QUALITY_PROBE_WINDOW)
+            m_window.pop_front();
+        double psnrSum = 0, ssimSum = 0, minPsnr = psnr;
+        for (auto &it : m_window) {
+            psnrSum += it.first;
+            ssimSum += it.second;
+            if (it.first < minPsnr)
+                minPsnr = it.first;
+        }
+        ++m_stats.samples;
+        m_stats.psnr = psnrSum / m_window.size();
+        m_stats.ssim = ssimSum / m_window.size();
+        m_stats.lastPsnr = psnr;
+        m_stats.lastSsim = ssim;
+        m_stats.minPsnr = minPsnr;
+        m_freeList.push_back(std::move(sample));
+    }
+}
+
+void NodeVideoQualityProbe::getStats(NodeQualityProbeStats &stats)
+{
+    std::lock_guard<std::mutex> lck(m_lock);
+    stats = m_stats;
+}
+
+} // namespace nertc_node
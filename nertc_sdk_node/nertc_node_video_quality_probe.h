@@ -0,0 +1,84 @@
+#ifndef NERTC_NODE_VIDEO_QUALITY_PROBE_H
+#define NERTC_NODE_VIDEO_QUALITY_PROBE_H
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <condition_variable>
+
+namespace nertc_node
+{
+    struct IVideoFrame;
+
+    // 质量探测的参考路径
+    enum NodeQualityReference
+    {
+        NODE_QUALITY_REFERENCE_SOURCE = 0, // 投递帧放大回源分辨率后与源帧比较，衡量缩放造成的细节损失
+        NODE_QUALITY_REFERENCE_BOX = 1     // 源帧用 box 滤波缩放到投递分辨率后与投递帧比较，衡量滤波档位的差距
+    };
+
+#define QUALITY_PROBE_DEFAULT_INTERVAL 30
+#define QUALITY_PROBE_WINDOW 30
+#define QUALITY_PROBE_MAX_QUEUE 2
+
+    struct NodeQualityProbeStats
+    {
+        uint64_t samples;     // 已完成计算的采样数
+        uint64_t dropped;     // 计算线程繁忙时丢弃的采样数
+        double psnr;          // 最近 QUALITY_PROBE_WINDOW 个采样的平均 PSNR（dB）
+        double ssim;          // 最近 QUALITY_PROBE_WINDOW 个采样的平均 SSIM
+        double lastPsnr;
+        double lastSsim;
+        double minPsnr;       // 窗口内最低 PSNR
+    };
+
+    // 每隔 interval 帧在视频回调线程中拷贝一份源帧与投递帧，
+    // 在独立线程中生成参考帧并计算 I420 PSNR/SSIM，不阻塞渲染路径。
+    class NodeVideoQualityProbe
+    {
+    public:
+        NodeVideoQualityProbe(uint32_t interval, NodeQualityReference reference);
+        ~NodeVideoQualityProbe();
+
+        void stop();
+        // 在视频回调线程中调用，未到采样帧时直接返回
+        void pushFrame(const IVideoFrame &source, const uint8_t *planes[3], const int strides[3], int width, int height);
+        void getStats(NodeQualityProbeStats &stats);
+
+    private:
+        struct ProbeSample
+        {
+            uint32_t sourceWidth;
+            uint32_t sourceHeight;
+            uint32_t width;
+            uint32_t height;
+            std::vector<uint8_t> source;    // 源帧，紧密排列的 I420
+            std::vector<uint8_t> delivered; // 投递帧，紧密排列的 I420
+            std::vector<uint8_t> reference;
+        };
+
+        void probeLoop();
+        void measure(ProbeSample &sample, double &psnr, double &ssim);
+
+    private:
+        uint32_t m_interval;
+        NodeQualityReference m_reference;
+        uint32_t m_frameCount;
+
+        std::mutex m_lock;
+        std::condition_variable m_cond;
+        std::deque<std::unique_ptr<ProbeSample>> m_queue;
+        std::vector<std::unique_ptr<ProbeSample>> m_freeList;
+        bool m_stopFlag;
+        std::unique_ptr<std::thread> m_thread;
+
+        std::deque<std::pair<double, double>> m_window;
+        NodeQualityProbeStats m_stats;
+    };
+
+} // namespace nertc_node
+
+#endif //NERTC_NODE_VIDEO_QUALITY_PROBE_H
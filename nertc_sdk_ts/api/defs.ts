@@ -349,6 +349,7 @@ export interface NERtcLiveStreamUserTranscoding {
     width: number;                      /**< 画面在主画面的显示宽度，画面右边超出主画面会失败 */
     height: number;                     /**< 画面在主画面的显示高度，画面底边超出主画面会失败 */
     audio_push: boolean;                /**< 是否推送该用户音频流 */
+    z_order?: number;                   /**< 图层顺序，默认 0 */
 }
 
 /** 图片布局 */
@@ -366,7 +367,7 @@ export interface NERtcLiveStreamLayout {
     height: number;                             /**< 视频推流高度 */
     background_color: number;          /**< 视频推流背景色，(R & 0xff) << 16 | (G & 0xff) << 8 | (B & 0xff) */
     user_count: number;                /**< 成员布局个数 */
-    users: Array<NERtcLiveStreamUserTranscoding>;  /**< 成员布局数组 */
+    users: Array<NERtcLiveStreamUserTranscoding> | Float64Array;  /**< 成员布局数组，也可以是 encodeLiveStreamUsers 编码的 Float64Array */
     bg_image: NERtcLiveStreamImageInfo;     /**< 背景图信息 */
 }
 
@@ -557,8 +558,8 @@ export interface NERtcEngineAPI {
     setSystemAudioLoopbackCaptureVolume(volume: number): number;
 
     // 4.0.x
-    sendSEIMsg(data: ArrayBuffer): number;
-    sendSEIMsgEx(data: ArrayBuffer, type: NERtcStreamChannelType): number;
+    sendSEIMsg(data: ArrayBuffer | ArrayBufferView): number;
+    sendSEIMsgEx(data: ArrayBuffer | ArrayBufferView, type: NERtcStreamChannelType): number;
     setExternalAudioRender(enable: boolean, sampleRate: number, channels: number): number;
     pullExternalAudioFrame(pullLength: number, cb: NERtcPullExternalAudioFrameCb): number;
 
@@ -580,6 +581,33 @@ export interface NERtcEngineAPI {
     checkNECastAudioDriver(): number;
     checkNeCastAudio(): number;
 
+    // 4.1.113
+    startVideoFrameDump(uid: number, streamType: NERtcStreamChannelType, path: String, format: NERtcVideoDumpFormat): number;
+    stopVideoFrameDump(uid: number, streamType: NERtcStreamChannelType): number;
+    enableSEIBatchDelivery(enable: boolean): number;
+    setSEIMessageFilter(uids: Array<number> | null, prefix: ArrayBuffer | null): number;
+    enableVideoFrameSEIAttachment(enable: boolean): number;
+    sendSEIMsgBatch(messages: Array<ArrayBuffer | ArrayBufferView>, type: NERtcStreamChannelType): number;
+    setSEISendRate(rate: number): number;
+    enableStatsSnapshot(enable: boolean): number;
+    setVideoOutputFormat(uid: number, streamType: NERtcStreamChannelType, format: NERtcVideoOutputFormat): number;
+    enableDuplicateFrameSuppression(uid: number, streamType: NERtcStreamChannelType, enable: boolean, sampleStep: number, refreshInterval: number): number;
+    getDuplicateFrameStats(uid: number, streamType: NERtcStreamChannelType): NERtcDuplicateFrameStats;
+    enableDirtyTileDelivery(uid: number, streamType: NERtcStreamChannelType, enable: boolean, tileSize: number, refreshInterval: number): number;
+    enableVideoQualityProbe(uid: number, streamType: NERtcStreamChannelType, enable: boolean, interval: number, reference: NERtcVideoQualityReference): number;
+    getVideoQualityProbeStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoQualityProbeStats;
+    setVideoScaleFilter(uid: number, streamType: NERtcStreamChannelType, filter: NERtcVideoScaleFilter): number;
+    setVideoScaleCpuBudget(budgetUs: number): number;
+    enableVideoLatencyStats(enable: boolean): number;
+    reportVideoFrameRendered(uid: number, streamType: NERtcStreamChannelType, timestamp: number): number;
+    getVideoLatencyStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoLatencyStats;
+    getVideoTransportStats(): Array<NERtcVideoTransportStats>;
+    setStreamRenderPriority(uid: number, streamType: NERtcStreamChannelType, priority: NERtcStreamRenderPriority): number;
+    setVideoRenderBudget(pixelsPerSecond: number): number;
+    setStreamVisibility(uid: number, streamType: NERtcStreamChannelType, visible: boolean, thumbnailInterval: number, thumbnailScale: number): number;
+    enableLazyStats(enable: boolean): number;
+    updateLiveStreamUsers(taskId: string, changes: Float64Array, removedUids: Array<number>): number;
+
     //TODO
     // setMixedAudioFrameParameters(samplerate: number): number;
     // setExternalVideoSource(enabled: boolean): number;
@@ -843,3 +871,148 @@ export enum NERtcVoiceEqualizationBand {
     kNERtcVoiceEqualizationBand_8K  = 8, /**<  8 kHz */
     kNERtcVoiceEqualizationBand_16K = 9, /**<  16 kHz */
 }
+
+/** 视频帧 dump 的文件格式 */
+export enum NERtcVideoDumpFormat {
+    kNERtcVideoDumpFormatI420 = 0, /**< 裸 I420 数据 */
+    kNERtcVideoDumpFormatY4M  = 1, /**< YUV4MPEG2（.y4m），可直接用 ffplay 等工具播放 */
+}
+
+/** 远端音频统计快照的列序号，见 onRemoteAudioStatsSnapshot */
+export enum NERtcRemoteAudioStatsColumn {
+    kNERtcRemoteAudioStatsUid             = 0, /**< 用户 ID */
+    kNERtcRemoteAudioStatsReceivedBitrate = 1, /**< 接收码率(Kbps) */
+    kNERtcRemoteAudioStatsTotalFrozenTime = 2, /**< 下行音频卡顿累计时长(ms) */
+    kNERtcRemoteAudioStatsFrozenRate      = 3, /**< 下行音频平均卡顿率(%) */
+    kNERtcRemoteAudioStatsAudioLossRate   = 4, /**< 音频丢包率(%) */
+    kNERtcRemoteAudioStatsVolume          = 5, /**< 音量，0 - 100 */
+    kNERtcRemoteAudioStatsColumnCount     = 6, /**< 列数 */
+}
+
+/** 远端视频统计快照的列序号，每个视频流 layer 占一行，见 onRemoteVideoStatsSnapshot */
+export enum NERtcRemoteVideoStatsColumn {
+    kNERtcRemoteVideoStatsUid               = 0, /**< 用户 ID */
+    kNERtcRemoteVideoStatsLayerType         = 1, /**< 流类型：1、主流，2、辅流 */
+    kNERtcRemoteVideoStatsWidth             = 2, /**< 视频流宽（像素） */
+    kNERtcRemoteVideoStatsHeight            = 3, /**< 视频流高（像素） */
+    kNERtcRemoteVideoStatsReceivedBitrate   = 4, /**< 接收码率(Kbps) */
+    kNERtcRemoteVideoStatsReceivedFrameRate = 5, /**< 接收帧率 */
+    kNERtcRemoteVideoStatsDecoderFrameRate  = 6, /**< 解码帧率 */
+    kNERtcRemoteVideoStatsRenderFrameRate   = 7, /**< 渲染帧率 */
+    kNERtcRemoteVideoStatsPacketLossRate    = 8, /**< 丢包率(%) */
+    kNERtcRemoteVideoStatsTotalFrozenTime   = 9, /**< 卡顿累计时长(ms) */
+    kNERtcRemoteVideoStatsFrozenRate        = 10, /**< 平均卡顿率(%) */
+    kNERtcRemoteVideoStatsColumnCount       = 11, /**< 列数 */
+}
+
+/** 网络质量快照的列序号，见 onNetworkQualitySnapshot */
+export enum NERtcNetworkQualityColumn {
+    kNERtcNetworkQualityUid         = 0, /**< 用户 ID */
+    kNERtcNetworkQualityTx          = 1, /**< 上行网络质量，取值同 NERtcNetworkQualityType */
+    kNERtcNetworkQualityRx          = 2, /**< 下行网络质量，取值同 NERtcNetworkQualityType */
+    kNERtcNetworkQualityColumnCount = 3, /**< 列数 */
+}
+
+/** 投递给渲染器的视频帧格式 */
+export enum NERtcVideoOutputFormat {
+    kNERtcVideoOutputFormatI420 = 0, /**< 平面 I420，默认 */
+    kNERtcVideoOutputFormatRGBA = 1, /**< RGBA，可直接用于 putImageData */
+    kNERtcVideoOutputFormatBGRA = 2, /**< BGRA，供自定义渲染器使用 */
+    kNERtcVideoOutputFormatNV12 = 3, /**< NV12，UV 交错存放，GlRenderer 只需上传两张纹理 */
+}
+
+/** 重复帧抑制的统计 */
+export interface NERtcDuplicateFrameStats
+{
+    checked_frames: number; /**< 参与比较的帧数 */
+    skipped_frames: number; /**< 内容未变化而跳过投递的帧数，命中率为 skipped_frames / checked_frames */
+}
+
+/** 质量探测的参考路径 */
+export enum NERtcVideoQualityReference {
+    kNERtcVideoQualityReferenceSource = 0, /**< 投递帧放大回源分辨率后与源帧比较，衡量缩放损失 */
+    kNERtcVideoQualityReferenceBox    = 1, /**< 源帧以 box 滤波缩放到投递分辨率后与投递帧比较，衡量滤波档位差距 */
+}
+
+/** 视频质量探测的统计 */
+export interface NERtcVideoQualityProbeStats
+{
+    samples: number; /**< 已完成计算的采样数 */
+    dropped: number; /**< 计算线程繁忙时丢弃的采样数 */
+    psnr: number; /**< 最近 30 个采样的平均 PSNR（dB），完全一致时为 128 */
+    ssim: number; /**< 最近 30 个采样的平均 SSIM，取值 0 ~ 1 */
+    last_psnr: number; /**< 最近一次采样的 PSNR（dB） */
+    last_ssim: number; /**< 最近一次采样的 SSIM */
+    min_psnr: number; /**< 最近 30 个采样中最低的 PSNR（dB） */
+}
+
+/** 渲染缩放的滤波档位 */
+export enum NERtcVideoScaleFilter {
+    kNERtcVideoScaleFilterNone     = 0, /**< 最近邻，最快，缩小较多时混叠明显 */
+    kNERtcVideoScaleFilterLinear   = 1, /**< 仅水平方向线性插值 */
+    kNERtcVideoScaleFilterBilinear = 2, /**< 双线性插值 */
+    kNERtcVideoScaleFilterBox      = 3, /**< 区域平均，缩小较多时画质最好 */
+    kNERtcVideoScaleFilterAuto     = 4, /**< 按缩放比例自动选择，超出 CPU 预算时逐级降档，默认 */
+}
+
+/** 视频帧某一阶段的时延分布（ms） */
+export interface NERtcVideoLatencyHistogram
+{
+    count: number; /**< 样本数 */
+    mean: number; /**< 平均值 */
+    p50: number; /**< 50 分位 */
+    p90: number; /**< 90 分位 */
+    p99: number; /**< 99 分位 */
+    max: number; /**< 最大值，分位值超过 1000 时按 1000 计 */
+}
+
+/** 视频帧各阶段的时延统计 */
+export interface NERtcVideoLatencyStats
+{
+    arrive_to_deliver: NERtcVideoLatencyHistogram; /**< SDK 回调到达至投递给 JS */
+    deliver_to_render: NERtcVideoLatencyHistogram; /**< 投递给 JS 至渲染完成 */
+    arrive_to_render: NERtcVideoLatencyHistogram; /**< SDK 回调到达至渲染完成 */
+}
+
+/** 单路视频流在 native 投递链路上的统计 */
+export interface NERtcVideoTransportStats
+{
+    uid: number; /**< 用户 ID，0 表示本地 */
+    stream_type: NERtcStreamChannelType; /**< 视频流类型 */
+    channel_id: string; /**< 频道名 */
+    received_frames: number; /**< SDK 回调的帧数 */
+    suppressed_frames: number; /**< 重复帧抑制或脏块无变化而未投递的帧数 */
+    copied_frames: number; /**< 拷贝/转换进投递缓冲的帧数 */
+    scaled_frames: number; /**< 其中需要缩放的帧数 */
+    coalesced_frames: number; /**< 投递前被新帧覆盖而丢弃的帧数 */
+    delivered_frames: number; /**< 实际投递给 JS 的帧数 */
+    throttled_frames: number; /**< 被渲染频率调控跳过的帧数 */
+    hidden_frames: number; /**< 流不可见而跳过的帧数 */
+    received_fps: number; /**< 最近 1 秒的回调帧率 */
+    delivered_fps: number; /**< 最近 1 秒的投递帧率 */
+    copied_bytes: number; /**< 累计拷贝进投递缓冲的字节数 */
+    copy_time_us: number; /**< 平均每帧拷贝/缩放/转换耗时（微秒） */
+    buffer_bytes: number; /**< 该流当前占用的投递缓冲字节数 */
+}
+
+/** 视频流的渲染优先级 */
+export enum NERtcStreamRenderPriority {
+    kNERtcStreamRenderPriorityActiveSpeaker = 0, /**< 当前说话者，最先满足 */
+    kNERtcStreamRenderPriorityPinned        = 1, /**< 固定显示的画面 */
+    kNERtcStreamRenderPriorityVisible       = 2, /**< 普通可见画面，默认 */
+    kNERtcStreamRenderPriorityOffscreen     = 3, /**< 不可见画面，最多 2 帧/秒 */
+}
+
+/** 直播成员布局二进制编码的字段序号，第 i 个成员的第 field 项位于 data[i * kNERtcLiveStreamUserFieldCount + field]，见 encodeLiveStreamUsers */
+export enum NERtcLiveStreamUserField {
+    kNERtcLiveStreamUserUid        = 0, /**< 用户 ID */
+    kNERtcLiveStreamUserVideoPush  = 1, /**< 是否推送视频流，0 或 1 */
+    kNERtcLiveStreamUserAdaption   = 2, /**< 视频流裁剪模式，见 NERtcLiveStreamVideoScaleMode */
+    kNERtcLiveStreamUserX          = 3, /**< 画面离主画面左边距 */
+    kNERtcLiveStreamUserY          = 4, /**< 画面离主画面上边距 */
+    kNERtcLiveStreamUserWidth      = 5, /**< 画面在主画面的显示宽度 */
+    kNERtcLiveStreamUserHeight     = 6, /**< 画面在主画面的显示高度 */
+    kNERtcLiveStreamUserAudioPush  = 7, /**< 是否推送音频流，0 或 1 */
+    kNERtcLiveStreamUserZOrder     = 8, /**< 图层顺序 */
+    kNERtcLiveStreamUserFieldCount = 9, /**< 字段数 */
+}
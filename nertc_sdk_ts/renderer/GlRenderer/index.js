@@ -10,6 +10,9 @@ const GlRender = function() {
   let yTexture;
   let uTexture;
   let vTexture;
+  let nv12Location;
+  let uvTextureSize = { width: 0, height: 0 };
+  let hasBaseFrame = false;
   let texCoordBuffer;
   let surfaceBuffer;
   const that = {
@@ -102,6 +105,11 @@ const GlRender = function() {
       return;
     }
 
+    // 脏块帧只有变化的块，需要叠加在已上传的完整 I420 帧上
+    if (image.tiles && (!hasBaseFrame || image.width != that.initWidth || image.height != that.initHeight)) {
+      return;
+    }
+
     if (
       image.width != that.initWidth ||
       image.height != that.initHeight ||
@@ -120,6 +128,11 @@ const GlRender = function() {
       });
     }
 
+    // 旋转或镜像变化重建画布后纹理还没有存储，脏块帧要等下一帧完整画面
+    if (image.tiles && !hasBaseFrame) {
+      return;
+    }
+
     // Console.log(image.width, "*", image.height, "planes "
     //    , " y ", image.yplane[0], image.yplane[image.yplane.length - 1]
     //    , " u ", image.uplane[0], image.uplane[image.uplane.length - 1]
@@ -149,7 +162,17 @@ const GlRender = function() {
     gl.enableVertexAttribArray(texCoordLocation);
     gl.vertexAttribPointer(texCoordLocation, 2, gl.FLOAT, false, 0, 0);
 
-    uploadYuv(xWidth, xHeight, image.yplane, image.uplane, image.vplane);
+    if (image.tiles) {
+      uploadTiles(xWidth, xHeight, image.tiles, image.yplane, image.uplane, image.vplane);
+    } else if (image.nv12) {
+      uploadNv12(xWidth, xHeight, image.yplane, image.uplane);
+      hasBaseFrame = false;
+    } else {
+      uploadYuv(xWidth, xHeight, image.yplane, image.uplane, image.vplane);
+      uvTextureSize = { width: 0, height: 0 };
+      hasBaseFrame = true;
+    }
+    gl.uniform1f(nv12Location, image.nv12 ? 1.0 : 0.0);
 
     updateCanvas(image.rotation, image.width, image.height);
     gl.drawArrays(gl.TRIANGLES, 0, 6);
@@ -169,11 +192,16 @@ const GlRender = function() {
    * @param {*} yplanedata
    * @param {*} uplanedata
    * @param {*} vplanedata
+   * @param {*} dirtyTiles 仅包含变化块时的块信息
    */
-  that.drawFrame = function({header, yUint8Array, uUint8Array, vUint8Array}) {
+  that.drawFrame = function({header, yUint8Array, uUint8Array, vUint8Array, dirtyTiles}) {
     var headerLength = 20;
     var dv = new DataView(header);
     var format = dv.getUint8(0);
+    if (format !== 0 && format !== 3) {
+      // 只支持 I420 与 NV12，RGBA/BGRA 帧请使用 SoftwareRenderer
+      return;
+    }
     var mirror = dv.getUint8(1);
     var width = dv.getUint16(2);
     var height = dv.getUint16(4);
@@ -203,6 +231,8 @@ const GlRender = function() {
       right,
       bottom,
       rotation: rotation,
+      nv12: format === 3,
+      tiles: format === 0 ? dirtyTiles : undefined,
       yplane: new Uint8Array(yUint8Array),
       uplane: new Uint8Array(uUint8Array),
       vplane: new Uint8Array(vUint8Array)
@@ -281,6 +311,103 @@ const GlRender = function() {
     }
   }
 
+  function uploadNv12(width, height, yplane, uvplane) {
+    var e
+    gl.pixelStorei(gl.UNPACK_ALIGNMENT, 1);
+    gl.activeTexture(gl.TEXTURE0);
+    gl.bindTexture(gl.TEXTURE_2D, yTexture);
+    gl.texImage2D(
+      gl.TEXTURE_2D,
+      0,
+      gl.LUMINANCE,
+      width,
+      height,
+      0,
+      gl.LUMINANCE,
+      gl.UNSIGNED_BYTE,
+      yplane
+    );
+
+    // UV 交错平面作为 LUMINANCE_ALPHA 纹理上传：U 在 r 通道，V 在 a 通道。
+    // 尺寸不变时复用已分配的纹理存储，只更新内容
+    gl.activeTexture(gl.TEXTURE1);
+    gl.bindTexture(gl.TEXTURE_2D, uTexture);
+    if (uvTextureSize.width === width / 2 && uvTextureSize.height === height / 2) {
+      gl.texSubImage2D(
+        gl.TEXTURE_2D,
+        0,
+        0,
+        0,
+        width / 2,
+        height / 2,
+        gl.LUMINANCE_ALPHA,
+        gl.UNSIGNED_BYTE,
+        uvplane
+      );
+    } else {
+      gl.texImage2D(
+        gl.TEXTURE_2D,
+        0,
+        gl.LUMINANCE_ALPHA,
+        width / 2,
+        height / 2,
+        0,
+        gl.LUMINANCE_ALPHA,
+        gl.UNSIGNED_BYTE,
+        uvplane
+      );
+      uvTextureSize = { width: width / 2, height: height / 2 };
+    }
+    if(config.getGlDebug()){
+      e = gl.getError();
+      if (e != gl.NO_ERROR) {
+        console.log('upload nv12 plane ', width, height, uvplane.byteLength, ' error', e);
+      }
+    }
+  }
+
+  function uploadTiles(width, height, tiles, yplane, uplane, vplane) {
+    gl.pixelStorei(gl.UNPACK_ALIGNMENT, 1);
+    uploadTilePlane(gl.TEXTURE0, yTexture, width, height, tiles, 0, yplane);
+    uploadTilePlane(gl.TEXTURE1, uTexture, width, height, tiles, 1, uplane);
+    uploadTilePlane(gl.TEXTURE2, vTexture, width, height, tiles, 1, vplane);
+  }
+
+  // 各平面的块数据按块的行优先顺序连续存放，shift 为 1 时为色度平面
+  function uploadTilePlane(unit, texture, width, height, tiles, shift, plane) {
+    var size = tiles.tileSize;
+    var offset = 0;
+    gl.activeTexture(unit);
+    gl.bindTexture(gl.TEXTURE_2D, texture);
+    for (var r = 0; r < tiles.rows; r++) {
+      for (var c = 0; c < tiles.columns; c++) {
+        if (!tiles.map[r * tiles.columns + c]) {
+          continue;
+        }
+        var w = Math.min(size, width - c * size) >> shift;
+        var h = Math.min(size, height - r * size) >> shift;
+        gl.texSubImage2D(
+          gl.TEXTURE_2D,
+          0,
+          (c * size) >> shift,
+          (r * size) >> shift,
+          w,
+          h,
+          gl.LUMINANCE,
+          gl.UNSIGNED_BYTE,
+          plane.subarray(offset, offset + w * h)
+        );
+        offset += w * h;
+      }
+    }
+    if(config.getGlDebug()){
+      var e = gl.getError();
+      if (e != gl.NO_ERROR) {
+        console.log('upload tiles ', width, height, plane.byteLength, ' error', e);
+      }
+    }
+  }
+
   function deleteBuffer(buffer) {
     if (buffer && gl) {
       gl.deleteBuffer(buffer);
@@ -309,6 +436,7 @@ const GlRender = function() {
     'precision mediump float;' +
     'uniform sampler2D Ytex;' +
     'uniform sampler2D Utex,Vtex;' +
+    'uniform float u_nv12;' +
     'varying vec2 v_texCoord;' +
     'void main(void) {' +
     '  float nx,ny,r,g,b,y,u,v;' +
@@ -316,8 +444,9 @@ const GlRender = function() {
     '  nx=v_texCoord[0];' +
     '  ny=v_texCoord[1];' +
     '  y=texture2D(Ytex,vec2(nx,ny)).r;' +
-    '  u=texture2D(Utex,vec2(nx,ny)).r;' +
-    '  v=texture2D(Vtex,vec2(nx,ny)).r;' +
+    '  ux=texture2D(Utex,vec2(nx,ny));' +
+    '  u=ux.r;' +
+    '  v=mix(texture2D(Vtex,vec2(nx,ny)).r,ux.a,u_nv12);' +
     '  y=1.1643*(y-0.0625);' +
     '  u=u-0.5;' +
     '  v=v-0.5;' +
@@ -433,6 +562,10 @@ const GlRender = function() {
 
     const v = gl.getUniformLocation(program, 'Vtex');
     gl.uniform1i(v, 2); /* Bind Vtex to texture unit 2 */
+
+    nv12Location = gl.getUniformLocation(program, 'u_nv12');
+    uvTextureSize = { width: 0, height: 0 };
+    hasBaseFrame = false;
   }
 
   function updateViewZoomLevel(rotation, width, height) {
@@ -11,7 +11,8 @@ interface IRenderer {
     header: any,
     yUint8Array: any,
     uUint8Array: any,
-    vUint8Array: any
+    vUint8Array: any,
+    dirtyTiles?: any
   }): void;
   setContentMode(mode: number): void;
   refreshCanvas(): void;
@@ -38,7 +39,8 @@ class GlRenderer implements IRenderer {
     header: any,
     yUint8Array: any,
     uUint8Array: any,
-    vUint8Array: any
+    vUint8Array: any,
+    dirtyTiles?: any
   }): void {
     return this.self.drawFrame(imageData);
   }
@@ -77,7 +79,8 @@ class CustomRenderer implements IRenderer {
     header: any,
     yUint8Array: any,
     uUint8Array: any,
-    vUint8Array: any
+    vUint8Array: any,
+    dirtyTiles?: any
   }) {
     throw new Error('You have to declare your own custom render');
   }
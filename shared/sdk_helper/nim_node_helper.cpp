@@ -1,4 +1,5 @@
 #include "../shared/sdk_helper/nim_node_helper.h"
+#include <vector>
 
 napi_status nim_napi_get_value_utf8string_list(Isolate* isolate, const Local<Value>& value, std::list<utf8_string>& out)
 {
@@ -14,6 +15,59 @@ napi_status nim_napi_get_value_utf8string_list(Isolate* isolate, const Local<Val
     }
     return status;    
 }
+// 每个线程（即每个 isolate 的 JS 线程）保留少量长字符串缓冲区，UTF8String 析构时归还，下次转换直接取用
+#define UTF8STRING_POOL_MAX_BUFFERS 8
+#define UTF8STRING_POOL_MAX_BUFFER_SIZE (64 * 1024)
+struct UTF8StringPool
+{
+    std::vector<std::pair<utf8_char*, size_t>> buffers;
+    ~UTF8StringPool()
+    {
+        for (auto& buffer : buffers)
+            free(buffer.first);
+    }
+};
+static thread_local UTF8StringPool t_stringPool;
+
+utf8_char* UTF8String::acquireBuffer(size_t size, size_t& capacity)
+{
+    auto& buffers = t_stringPool.buffers;
+    for (auto it = buffers.begin(); it != buffers.end(); ++it)
+    {
+        if (it->second >= size)
+        {
+            utf8_char* buf = it->first;
+            capacity = it->second;
+            buffers.erase(it);
+            return buf;
+        }
+    }
+    // 按 256 字节取整，便于不同长度的字符串复用同一块缓冲区
+    capacity = (size + 255) & ~(size_t)255;
+    return (utf8_char*)malloc(capacity);
+}
+
+void UTF8String::releaseBuffer(utf8_char* buf, size_t capacity)
+{
+    auto& buffers = t_stringPool.buffers;
+    if (capacity > UTF8STRING_POOL_MAX_BUFFER_SIZE || buffers.size() >= UTF8STRING_POOL_MAX_BUFFERS)
+    {
+        free(buf);
+        return;
+    }
+    buffers.emplace_back(buf, capacity);
+}
+
+static bool is_ascii(const utf8_char* str, int len)
+{
+    for (int i = 0; i < len; i++)
+    {
+        if ((uint8_t)str[i] & 0x80)
+            return false;
+    }
+    return true;
+}
+
 napi_status nim_napi_get_value_utf8string(Isolate* isolate, const Local<Value>& value, UTF8String& out)
 {
     if (!value->IsString())
@@ -22,14 +76,25 @@ napi_status nim_napi_get_value_utf8string(Isolate* isolate, const Local<Value>&
     out.clear();
     napi_status status = napi_ok;
     do {
-        int len = value.As<String>()->Utf8Length(isolate);
+        Local<String> str = value.As<String>();
+        int len = str->Length();
         if (len == 0) break;
-        utf8_char *str = (utf8_char *)calloc(len + 1, 1);
-        if (!str) break;
-        len = value.As<String>()->WriteUtf8(isolate, str, len, nullptr, String::REPLACE_INVALID_UTF8 | String::NO_NULL_TERMINATION);
-        str[len] = '\0';
-        out.set(str, len);
-        free(str);
+        // 单字节字符串先按 Latin-1 直接拷贝，全部为 ASCII 时即为 UTF-8 结果，省去 UTF-8 长度计算与编码
+        if (str->IsOneByte())
+        {
+            utf8_char* buf = out.reserve(len);
+            str->WriteOneByte(isolate, (uint8_t*)buf, 0, len, String::NO_NULL_TERMINATION);
+            if (is_ascii(buf, len))
+            {
+                out.commit(len);
+                break;
+            }
+        }
+        // 每个 UTF-16 单元最多编码为 3 字节，短字符串按上界直接写入内部存储，其余先计算准确长度
+        int capacity = len * 3 < UTF8STRING_INLINE_SIZE ? len * 3 : str->Utf8Length(isolate);
+        utf8_char* buf = out.reserve(capacity);
+        len = str->WriteUtf8(isolate, buf, capacity, nullptr, String::REPLACE_INVALID_UTF8 | String::NO_NULL_TERMINATION);
+        out.commit(len);
     } while (false);
     return status;
 }
@@ -84,9 +149,46 @@ napi_status nim_napi_get_value_double(Isolate* isolate, const Local<Value>& valu
     return napi_ok;
 }
 
-static napi_status get_object_value(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, Local<Value> &out)
+void* nim_napi_get_arraybuffer_data(const Local<ArrayBuffer>& buffer)
+{
+#if V8_MAJOR_VERSION >= 8
+    return buffer->GetBackingStore()->Data();
+#else
+    return buffer->GetContents().Data();
+#endif
+}
+
+napi_status nim_napi_get_value_buffer(const Local<Value>& value, const char*& data, size_t& length, std::string& storage)
+{
+    if (value->IsArrayBufferView())
+    {
+        auto view = value.As<v8::ArrayBufferView>();
+        length = view->ByteLength();
+        if (!view->HasBuffer())
+        {
+            // 堆内的 TypedArray（默认不超过 64 字节）调用 Buffer() 会把数据迁出堆并新建 ArrayBuffer，直接拷贝开销更小
+            storage.resize(length);
+            if (length > 0)
+                view->CopyContents(&storage[0], length);
+            data = storage.data();
+            return napi_ok;
+        }
+        data = static_cast<const char*>(nim_napi_get_arraybuffer_data(view->Buffer())) + view->ByteOffset();
+        return napi_ok;
+    }
+    if (value->IsArrayBuffer())
+    {
+        auto buffer = value.As<ArrayBuffer>();
+        length = buffer->ByteLength();
+        data = static_cast<const char*>(nim_napi_get_arraybuffer_data(buffer));
+        return napi_ok;
+    }
+    return napi_invalid_arg;
+}
+
+static napi_status get_object_value(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, Local<Value> &out)
 {
-    auto name = nim_napi_new_utf8string(isolate, keyName.c_str());
+    auto name = nim_napi_new_key(isolate, keyName);
     auto maybeValue = obj->Get(isolate->GetCurrentContext(), name);
     if (!maybeValue.IsEmpty()) {
         out = maybeValue.ToLocalChecked();
@@ -95,49 +197,49 @@ static napi_status get_object_value(Isolate* isolate, const Local<Object>& obj,
     return napi_invalid_arg;
 }
 
-napi_status nim_napi_get_object_value(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, Local<Value>& out)
+napi_status nim_napi_get_object_value(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, Local<Value>& out)
 {
     if (get_object_value(isolate, obj, keyName, out) == napi_ok && !out.IsEmpty())
         return napi_ok;
     return napi_invalid_arg;
 }
 
-napi_status nim_napi_get_object_value_utf8string(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, UTF8String& out)
+napi_status nim_napi_get_object_value_utf8string(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, UTF8String& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
         return nim_napi_get_value_utf8string(isolate, value, out);
     return napi_invalid_arg;
 }
-napi_status nim_napi_get_object_value_uint32(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, uint32_t& out)
+napi_status nim_napi_get_object_value_uint32(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, uint32_t& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
         return nim_napi_get_value_uint32(isolate, value, out);
     return napi_invalid_arg;
 }
-napi_status nim_napi_get_object_value_int32(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, int32_t& out)
+napi_status nim_napi_get_object_value_int32(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, int32_t& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
         return nim_napi_get_value_int32(isolate, value, out);
     return napi_invalid_arg;
 }
-napi_status nim_napi_get_object_value_bool(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, bool& out)
+napi_status nim_napi_get_object_value_bool(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, bool& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
         return nim_napi_get_value_bool(isolate, value, out);
     return napi_invalid_arg;
 }
-napi_status nim_napi_get_object_value_int64(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, int64_t& out)
+napi_status nim_napi_get_object_value_int64(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, int64_t& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
         return nim_napi_get_value_int64(isolate, value, out);
     return napi_invalid_arg;
 }
-napi_status nim_napi_get_object_value_uint64(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, uint64_t& out)
+napi_status nim_napi_get_object_value_uint64(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, uint64_t& out)
 {
     Local<Value> value;
     if (get_object_value(isolate, obj, keyName, value) == napi_ok)
@@ -145,49 +247,60 @@ napi_status nim_napi_get_object_value_uint64(Isolate* isolate, const Local<Objec
     return napi_invalid_arg;
 }
 
-napi_status nim_napi_set_object_value_utf8string(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const utf8_string& keyValue)
+napi_status nim_napi_set_object_value_utf8string(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const utf8_string& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_utf8string(isolate, keyValue.c_str());
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;
 }
 
-napi_status nim_napi_set_object_value_uint32(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const uint32_t& keyValue)
+napi_status nim_napi_set_object_value_uint32(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const uint32_t& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_uint32(isolate, keyValue);
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;
 }
-napi_status nim_napi_set_object_value_int32(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const int32_t& keyValue)
+napi_status nim_napi_set_object_value_int32(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const int32_t& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_int32(isolate, keyValue);
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;    
 }
-napi_status nim_napi_set_object_value_bool(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const bool& keyValue)
+napi_status nim_napi_set_object_value_bool(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const bool& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_bool(isolate, keyValue);
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;     
 }
-napi_status nim_napi_set_object_value_int64(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const int64_t& keyValue)
+napi_status nim_napi_set_object_value_int64(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const int64_t& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_int64(isolate, keyValue);
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;      
 }
-napi_status nim_napi_set_object_value_uint64(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const uint64_t& keyValue)
+napi_status nim_napi_set_object_value_uint64(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const uint64_t& keyValue)
 {
-    Local<Value> key = nim_napi_new_utf8string(isolate, keyName.c_str());
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
     Local<Value> value = nim_napi_new_uint64(isolate, keyValue);
     obj->Set(isolate->GetCurrentContext(), key, value);
     return napi_ok;  
 }
+napi_status nim_napi_set_object_value_double(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const double& keyValue)
+{
+    Local<Value> key = nim_napi_new_key(isolate, keyName);
+    Local<Value> value = nim_napi_new_double(isolate, keyValue);
+    obj->Set(isolate->GetCurrentContext(), key, value);
+    return napi_ok;
+}
+Local<String> nim_napi_new_key(Isolate* isolate, const nim_node::key_name& keyName)
+{
+    return nim_node::key_cache::get_instance(isolate)->get(isolate, keyName);
+}
 Local<Value> nim_napi_new_utf8string(Isolate* isolate, const utf8_char *keyValue)
 {
     return String::NewFromUtf8(isolate, keyValue ? keyValue : "", NewStringType::kInternalized).ToLocalChecked();
@@ -217,6 +330,10 @@ Local<Value> nim_napi_new_uint64(Isolate* isolate, const uint64_t& keyValue)
     //TODO
     return Number::New(isolate, (double)keyValue);
 }
+Local<Value> nim_napi_new_double(Isolate* isolate, const double& keyValue)
+{
+    return Number::New(isolate, keyValue);
+}
 
 napi_status nim_napi_assemble_string_array(Isolate* isolate, const std::list<utf8_string>& strs, Local<Array>& arr)
 {
@@ -7,6 +7,7 @@
 #include <list>
 #include <string>
 #include <map>
+#include "nim_node_key_cache.h"
 
 using v8::Context;
 using v8::Function;
@@ -155,11 +156,15 @@ TypeName& operator=(const TypeName&) = delete
 
 typedef char utf8_char;
 typedef std::string utf8_string;
+// 不超过该长度的字符串直接存放在对象内部，不分配堆内存
+#define UTF8STRING_INLINE_SIZE 64
 class UTF8String
 {
 public:
-    UTF8String() : _mem(nullptr), _len(0) {}
+    UTF8String() : _mem(nullptr), _len(0), _heap(nullptr), _heapCap(0) {}
     // UTF8String(utf8_char* buf, int len) : _mem(buf), _len(len) {}
+    UTF8String(const UTF8String&) = delete;
+    UTF8String& operator=(const UTF8String&) = delete;
     ~UTF8String()
     {
         clear();
@@ -167,23 +172,48 @@ public:
 
     void clear()
     {
-        if (_mem) {
-            free(_mem);
-            _mem = nullptr;
+        if (_heap) {
+            releaseBuffer(_heap, _heapCap);
+            _heap = nullptr;
+            _heapCap = 0;
         }
+        _mem = nullptr;
         _len = 0;
     }
 
-    void set(utf8_char* buf, int len)
+    void set(const utf8_char* buf, int len)
     {
-        if (_mem) {
-            free(_mem);
-            _mem = nullptr;
+        utf8_char* dst = reserve(len);
+        memcpy(dst, buf, len);
+        commit(len);
+    }
+
+    // 返回至少可写 len + 1 字节的缓冲区，写入后调用 commit 设置实际长度；
+    // 短字符串使用内部存储，长字符串从当前线程的缓冲池取用，已有的堆缓冲区足够大时直接复用
+    utf8_char* reserve(int len)
+    {
+        if (len < UTF8STRING_INLINE_SIZE) {
+            _mem = _inline;
+        } else {
+            if ((size_t)len >= _heapCap) {
+                if (_heap)
+                    releaseBuffer(_heap, _heapCap);
+                _heap = acquireBuffer(len + 1, _heapCap);
+            }
+            _mem = _heap;
         }
-        _mem = (utf8_char *)calloc(len + 1, sizeof(utf8_char));
-        strcpy(_mem, buf);
-        // strcpy_s(_mem, len + 1, buf);
+        _len = 0;
+        return _mem;
+    }
+
+    void commit(int len)
+    {
         _len = len;
+        if (len == 0) {
+            _mem = nullptr;
+            return;
+        }
+        _mem[len] = '\0';
     }
 
     int length()
@@ -204,8 +234,14 @@ public:
     }
 
 private:
+    static utf8_char* acquireBuffer(size_t size, size_t& capacity);
+    static void releaseBuffer(utf8_char* buf, size_t capacity);
+
     utf8_char* _mem;
     int _len;
+    utf8_char* _heap;
+    size_t _heapCap;
+    utf8_char _inline[UTF8STRING_INLINE_SIZE];
 };
 
 napi_status nim_napi_get_value_utf8string_list(Isolate* isolate, const Local<Value>& value, std::list<utf8_string>& out);
@@ -217,28 +253,36 @@ napi_status nim_napi_get_value_bool(Isolate* isolate, const Local<Value>& value,
 napi_status nim_napi_get_value_int64(Isolate* isolate, const Local<Value>& value, int64_t& out);
 napi_status nim_napi_get_value_uint64(Isolate* isolate, const Local<Value>& value, uint64_t& out);
 napi_status nim_napi_get_value_double(Isolate* isolate, const Local<Value>& value, double& out);
-
-napi_status nim_napi_get_object_value(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, Local<Value>& out);
-napi_status nim_napi_get_object_value_utf8string(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, UTF8String& out);
-napi_status nim_napi_get_object_value_uint32(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, uint32_t& out);
-napi_status nim_napi_get_object_value_int32(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, int32_t& out);
-napi_status nim_napi_get_object_value_bool(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, bool& out);
-napi_status nim_napi_get_object_value_int64(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, int64_t& out);
-napi_status nim_napi_get_object_value_uint64(Isolate* isolate, const Local<Object>& obj, const utf8_string& keyName, uint64_t& out);
-
+// 接受 ArrayBuffer 或任意 ArrayBufferView，按视图的 byteOffset/byteLength 返回数据指针。
+// 已有 ArrayBuffer 的数据直接引用不拷贝；仍在 V8 堆内的小 TypedArray 拷贝到 storage，data 在 storage 存续期间有效
+napi_status nim_napi_get_value_buffer(const Local<Value>& value, const char*& data, size_t& length, std::string& storage);
+void* nim_napi_get_arraybuffer_data(const Local<ArrayBuffer>& buffer);
+
+napi_status nim_napi_get_object_value(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, Local<Value>& out);
+napi_status nim_napi_get_object_value_utf8string(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, UTF8String& out);
+napi_status nim_napi_get_object_value_uint32(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, uint32_t& out);
+napi_status nim_napi_get_object_value_int32(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, int32_t& out);
+napi_status nim_napi_get_object_value_bool(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, bool& out);
+napi_status nim_napi_get_object_value_int64(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, int64_t& out);
+napi_status nim_napi_get_object_value_uint64(Isolate* isolate, const Local<Object>& obj, const nim_node::key_name& keyName, uint64_t& out);
+
+// 属性名走 isolate 级缓存，返回常驻的内部化字符串
+Local<String> nim_napi_new_key(Isolate* isolate, const nim_node::key_name& keyName);
 Local<Value> nim_napi_new_utf8string(Isolate* isolate, const utf8_char *keyValue);
 Local<Value> nim_napi_new_uint32(Isolate* isolate, const uint32_t& keyValue);
 Local<Value> nim_napi_new_int32(Isolate* isolate, const int32_t& keyValue);
 Local<Value> nim_napi_new_bool(Isolate* isolate, const bool& keyValue);
 Local<Value> nim_napi_new_int64(Isolate* isolate, const int64_t& keyValue);
 Local<Value> nim_napi_new_uint64(Isolate* isolate, const uint64_t& keyValue);
-
-napi_status nim_napi_set_object_value_utf8string(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const utf8_string& keyValue);
-napi_status nim_napi_set_object_value_uint32(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const uint32_t& keyValue);
-napi_status nim_napi_set_object_value_int32(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const int32_t& keyValue);
-napi_status nim_napi_set_object_value_bool(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const bool& keyValue);
-napi_status nim_napi_set_object_value_int64(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const int64_t& keyValue);
-napi_status nim_napi_set_object_value_uint64(Isolate* isolate, Local<Object>& obj, const utf8_string& keyName, const uint64_t& keyValue);
+Local<Value> nim_napi_new_double(Isolate* isolate, const double& keyValue);
+
+napi_status nim_napi_set_object_value_utf8string(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const utf8_string& keyValue);
+napi_status nim_napi_set_object_value_uint32(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const uint32_t& keyValue);
+napi_status nim_napi_set_object_value_int32(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const int32_t& keyValue);
+napi_status nim_napi_set_object_value_bool(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const bool& keyValue);
+napi_status nim_napi_set_object_value_int64(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const int64_t& keyValue);
+napi_status nim_napi_set_object_value_uint64(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const uint64_t& keyValue);
+napi_status nim_napi_set_object_value_double(Isolate* isolate, Local<Object>& obj, const nim_node::key_name& keyName, const double& keyValue);
 
 napi_status nim_napi_assemble_string_array(Isolate* isolate, const std::list<utf8_string>& strs, Local<Array>& arr);
 napi_status nim_napi_assemble_string_map(Isolate* isolate, const std::map<utf8_string, utf8_string>& ipt, Local<Object>& opt);
@@ -0,0 +1,125 @@
+#include "nim_node_key_cache.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace nim_node
+{
+
+static std::mutex g_cache_lock;
+static std::unordered_map<v8::Isolate *, key_cache *> g_caches;
+// 同一线程连续访问同一 isolate 时跳过全局表查找
+static thread_local v8::Isolate *t_isolate = nullptr;
+static thread_local key_cache *t_cache = nullptr;
+
+static uint32_t hash_key(const char *data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+key_cache::key_cache(v8::Isolate *isolate)
+    : isolate_(isolate), count_(0), enabled_(true)
+{
+}
+
+key_cache *key_cache::get_instance(v8::Isolate *isolate)
+{
+    if (t_isolate == isolate && t_cache)
+        return t_cache;
+    std::lock_guard<std::mutex> guard(g_cache_lock);
+    key_cache *&cache = g_caches[isolate];
+    if (!cache)
+    {
+        cache = new key_cache(isolate);
+        // Eternal 句柄随 isolate 一起释放，这里只回收表本身
+        node::AddEnvironmentCleanupHook(isolate, &key_cache::release, cache);
+    }
+    t_isolate = isolate;
+    t_cache = cache;
+    return cache;
+}
+
+void key_cache::release(void *arg)
+{
+    key_cache *cache = static_cast<key_cache *>(arg);
+    {
+        std::lock_guard<std::mutex> guard(g_cache_lock);
+        g_caches.erase(cache->isolate_);
+    }
+    if (t_cache == cache)
+    {
+        t_isolate = nullptr;
+        t_cache = nullptr;
+    }
+    delete cache;
+}
+
+v8::Local<v8::String> key_cache::get(v8::Isolate *isolate, const key_name &name)
+{
+    if (name.length == 0)
+        return v8::String::Empty(isolate);
+    if (!enabled_)
+        return v8::String::NewFromUtf8(isolate, name.data, v8::NewStringType::kInternalized, (int)name.length).ToLocalChecked();
+
+    uint32_t hash = hash_key(name.data, name.length);
+    size_t mask = entries_.size() - 1;
+    size_t slot = hash & mask;
+    if (!entries_.empty())
+    {
+        for (;; slot = (slot + 1) & mask)
+        {
+            entry &e = entries_[slot];
+            if (e.name.empty())
+                break;
+            if (e.hash == hash && e.name.size() == name.length && memcmp(e.name.data(), name.data, name.length) == 0)
+                return e.key.Get(isolate);
+        }
+    }
+
+    v8::Local<v8::String> key = v8::String::NewFromUtf8(isolate, name.data, v8::NewStringType::kInternalized, (int)name.length).ToLocalChecked();
+    if (count_ >= KEY_CACHE_MAX_KEYS)
+        return key;
+    if (entries_.empty() || (count_ + 1) * 4 > entries_.size() * 3)
+    {
+        rehash(entries_.empty() ? 256 : entries_.size() * 2);
+        mask = entries_.size() - 1;
+        for (slot = hash & mask; !entries_[slot].name.empty(); slot = (slot + 1) & mask)
+            ;
+    }
+    entry &e = entries_[slot];
+    e.hash = hash;
+    e.name.assign(name.data, name.length);
+    e.key.Set(isolate, key);
+    ++count_;
+    return key;
+}
+
+void key_cache::rehash(size_t capacity)
+{
+    std::vector<entry> old;
+    old.swap(entries_);
+    entries_.resize(capacity);
+    size_t mask = capacity - 1;
+    for (auto &e : old)
+    {
+        if (e.name.empty())
+            continue;
+        size_t slot = e.hash & mask;
+        while (!entries_[slot].name.empty())
+            slot = (slot + 1) & mask;
+        entries_[slot] = std::move(e);
+    }
+}
+
+void key_cache::preload(v8::Isolate *isolate, const char *const names[], size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        get(isolate, names[i]);
+}
+
+}
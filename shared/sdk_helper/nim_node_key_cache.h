@@ -0,0 +1,61 @@
+#ifndef NIM_NODE_KEY_CACHE_H
+#define NIM_NODE_KEY_CACHE_H
+
+#include <node.h>
+#include <string>
+#include <vector>
+#include <string.h>
+#include <stdint.h>
+
+namespace nim_node
+{
+
+#define KEY_CACHE_MAX_KEYS 2048
+
+// 属性名的轻量引用，字面量与 std::string 均可隐式转换，避免每次调用构造 std::string
+struct key_name
+{
+    const char *data;
+    size_t length;
+
+    key_name(const char *str) : data(str ? str : ""), length(str ? strlen(str) : 0) {}
+    key_name(const std::string &str) : data(str.c_str()), length(str.size()) {}
+};
+
+// 每个 isolate 一份的属性名缓存：首次使用时创建内部化字符串并以 Eternal 句柄常驻，
+// 之后同名属性直接复用，不再经过 UTF-8 解码与字符串表查找。
+// 只在 JS 线程访问；缓存条目超过 KEY_CACHE_MAX_KEYS 后不再新增，直接返回新建的字符串
+class key_cache
+{
+    key_cache(const key_cache &) = delete;
+    key_cache &operator=(const key_cache &) = delete;
+
+public:
+    static key_cache *get_instance(v8::Isolate *isolate);
+
+    v8::Local<v8::String> get(v8::Isolate *isolate, const key_name &name);
+    void preload(v8::Isolate *isolate, const char *const names[], size_t count);
+    size_t size() const { return count_; }
+    // 关闭后每次都新建内部化字符串，仅用于对比测试
+    void set_enabled(bool enable) { enabled_ = enable; }
+
+private:
+    struct entry
+    {
+        uint32_t hash;
+        std::string name;
+        v8::Eternal<v8::String> key;
+    };
+
+    explicit key_cache(v8::Isolate *isolate);
+    static void release(void *arg);
+    void rehash(size_t capacity);
+
+    v8::Isolate *isolate_;
+    std::vector<entry> entries_; // 开放寻址，容量为 2 的幂，name 为空表示空槽
+    size_t count_;
+    bool enabled_;
+};
+
+}
+#endif //NIM_NODE_KEY_CACHE_H
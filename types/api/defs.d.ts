@@ -291,6 +291,7 @@ export interface NERtcLiveStreamUserTranscoding {
     width: number; /**< 画面在主画面的显示宽度，画面右边超出主画面会失败 */
     height: number; /**< 画面在主画面的显示高度，画面底边超出主画面会失败 */
     audio_push: boolean; /**< 是否推送该用户音频流 */
+    z_order?: number;    /**< 图层顺序，默认 0 */
 }
 /** 图片布局 */
 export interface NERtcLiveStreamImageInfo {
@@ -306,7 +307,7 @@ export interface NERtcLiveStreamLayout {
     height: number; /**< 视频推流高度 */
     background_color: number; /**< 视频推流背景色，(R & 0xff) << 16 | (G & 0xff) << 8 | (B & 0xff) */
     user_count: number; /**< 成员布局个数 */
-    users: Array<NERtcLiveStreamUserTranscoding>; /**< 成员布局数组 */
+    users: Array<NERtcLiveStreamUserTranscoding> | Float64Array; /**< 成员布局数组，也可以是 encodeLiveStreamUsers 编码的 Float64Array */
     bg_image: NERtcLiveStreamImageInfo; /**< 背景图信息 */
 }
 export interface NERtcLiveConfig {
@@ -473,8 +474,8 @@ export interface NERtcEngineAPI {
     startSystemAudioLoopbackCapture(): number;
     stopSystemAudioLoopbackCapture(): number;
     setSystemAudioLoopbackCaptureVolume(volume: number): number;
-    sendSEIMsg(data: ArrayBuffer): number;
-    sendSEIMsgEx(data: ArrayBuffer, type: NERtcStreamChannelType): number;
+    sendSEIMsg(data: ArrayBuffer | ArrayBufferView): number;
+    sendSEIMsgEx(data: ArrayBuffer | ArrayBufferView, type: NERtcStreamChannelType): number;
     setExternalAudioRender(enable: boolean, sampleRate: number, channels: number): number;
     pullExternalAudioFrame(pullLength: number, cb: NERtcPullExternalAudioFrameCb): number;
     setAudioEffectPreset(type: NERtcVoiceChangerType): number;
@@ -489,6 +490,31 @@ export interface NERtcEngineAPI {
     adjustUserPlaybackSignalVolume(uid: number, volume: number, streamType: NERtcAudioStreamType): number;
     checkNECastAudioDriver(): number;
     checkNeCastAudio(): boolean;
+    startVideoFrameDump(uid: number, streamType: NERtcStreamChannelType, path: String, format: NERtcVideoDumpFormat): number;
+    stopVideoFrameDump(uid: number, streamType: NERtcStreamChannelType): number;
+    enableSEIBatchDelivery(enable: boolean): number;
+    setSEIMessageFilter(uids: Array<number> | null, prefix: ArrayBuffer | null): number;
+    enableVideoFrameSEIAttachment(enable: boolean): number;
+    sendSEIMsgBatch(messages: Array<ArrayBuffer | ArrayBufferView>, type: NERtcStreamChannelType): number;
+    setSEISendRate(rate: number): number;
+    enableStatsSnapshot(enable: boolean): number;
+    setVideoOutputFormat(uid: number, streamType: NERtcStreamChannelType, format: NERtcVideoOutputFormat): number;
+    enableDuplicateFrameSuppression(uid: number, streamType: NERtcStreamChannelType, enable: boolean, sampleStep: number, refreshInterval: number): number;
+    getDuplicateFrameStats(uid: number, streamType: NERtcStreamChannelType): NERtcDuplicateFrameStats;
+    enableDirtyTileDelivery(uid: number, streamType: NERtcStreamChannelType, enable: boolean, tileSize: number, refreshInterval: number): number;
+    enableVideoQualityProbe(uid: number, streamType: NERtcStreamChannelType, enable: boolean, interval: number, reference: NERtcVideoQualityReference): number;
+    getVideoQualityProbeStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoQualityProbeStats;
+    setVideoScaleFilter(uid: number, streamType: NERtcStreamChannelType, filter: NERtcVideoScaleFilter): number;
+    setVideoScaleCpuBudget(budgetUs: number): number;
+    enableVideoLatencyStats(enable: boolean): number;
+    reportVideoFrameRendered(uid: number, streamType: NERtcStreamChannelType, timestamp: number): number;
+    getVideoLatencyStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoLatencyStats;
+    getVideoTransportStats(): Array<NERtcVideoTransportStats>;
+    setStreamRenderPriority(uid: number, streamType: NERtcStreamChannelType, priority: NERtcStreamRenderPriority): number;
+    setVideoRenderBudget(pixelsPerSecond: number): number;
+    setStreamVisibility(uid: number, streamType: NERtcStreamChannelType, visible: boolean, thumbnailInterval: number, thumbnailScale: number): number;
+    enableLazyStats(enable: boolean): number;
+    updateLiveStreamUsers(taskId: string, changes: Float64Array, removedUids: Array<number>): number;
 }
 /** 通话相关的统计信息。*/
 export interface NERtcStats {
@@ -707,3 +733,129 @@ export declare enum NERtcVoiceEqualizationBand {
     kNERtcVoiceEqualizationBand_8K = 8,
     kNERtcVoiceEqualizationBand_16K = 9
 }
+/** 视频帧 dump 的文件格式 */
+export declare enum NERtcVideoDumpFormat {
+    kNERtcVideoDumpFormatI420 = 0,
+    kNERtcVideoDumpFormatY4M = 1
+}
+/** 远端音频统计快照的列序号，见 onRemoteAudioStatsSnapshot */
+export declare enum NERtcRemoteAudioStatsColumn {
+    kNERtcRemoteAudioStatsUid = 0,
+    kNERtcRemoteAudioStatsReceivedBitrate = 1,
+    kNERtcRemoteAudioStatsTotalFrozenTime = 2,
+    kNERtcRemoteAudioStatsFrozenRate = 3,
+    kNERtcRemoteAudioStatsAudioLossRate = 4,
+    kNERtcRemoteAudioStatsVolume = 5,
+    kNERtcRemoteAudioStatsColumnCount = 6
+}
+/** 远端视频统计快照的列序号，每个视频流 layer 占一行，见 onRemoteVideoStatsSnapshot */
+export declare enum NERtcRemoteVideoStatsColumn {
+    kNERtcRemoteVideoStatsUid = 0,
+    kNERtcRemoteVideoStatsLayerType = 1,
+    kNERtcRemoteVideoStatsWidth = 2,
+    kNERtcRemoteVideoStatsHeight = 3,
+    kNERtcRemoteVideoStatsReceivedBitrate = 4,
+    kNERtcRemoteVideoStatsReceivedFrameRate = 5,
+    kNERtcRemoteVideoStatsDecoderFrameRate = 6,
+    kNERtcRemoteVideoStatsRenderFrameRate = 7,
+    kNERtcRemoteVideoStatsPacketLossRate = 8,
+    kNERtcRemoteVideoStatsTotalFrozenTime = 9,
+    kNERtcRemoteVideoStatsFrozenRate = 10,
+    kNERtcRemoteVideoStatsColumnCount = 11
+}
+/** 网络质量快照的列序号，见 onNetworkQualitySnapshot */
+export declare enum NERtcNetworkQualityColumn {
+    kNERtcNetworkQualityUid = 0,
+    kNERtcNetworkQualityTx = 1,
+    kNERtcNetworkQualityRx = 2,
+    kNERtcNetworkQualityColumnCount = 3
+}
+/** 投递给渲染器的视频帧格式 */
+export declare enum NERtcVideoOutputFormat {
+    kNERtcVideoOutputFormatI420 = 0,
+    kNERtcVideoOutputFormatRGBA = 1,
+    kNERtcVideoOutputFormatBGRA = 2,
+    kNERtcVideoOutputFormatNV12 = 3
+}
+/** 重复帧抑制的统计 */
+export interface NERtcDuplicateFrameStats {
+    checked_frames: number; /**< 参与比较的帧数 */
+    skipped_frames: number; /**< 内容未变化而跳过投递的帧数，命中率为 skipped_frames / checked_frames */
+}
+/** 质量探测的参考路径 */
+export declare enum NERtcVideoQualityReference {
+    kNERtcVideoQualityReferenceSource = 0,
+    kNERtcVideoQualityReferenceBox = 1
+}
+/** 视频质量探测的统计 */
+export interface NERtcVideoQualityProbeStats {
+    samples: number; /**< 已完成计算的采样数 */
+    dropped: number; /**< 计算线程繁忙时丢弃的采样数 */
+    psnr: number; /**< 最近 30 个采样的平均 PSNR（dB），完全一致时为 128 */
+    ssim: number; /**< 最近 30 个采样的平均 SSIM，取值 0 ~ 1 */
+    last_psnr: number; /**< 最近一次采样的 PSNR（dB） */
+    last_ssim: number; /**< 最近一次采样的 SSIM */
+    min_psnr: number; /**< 最近 30 个采样中最低的 PSNR（dB） */
+}
+/** 渲染缩放的滤波档位 */
+export declare enum NERtcVideoScaleFilter {
+    kNERtcVideoScaleFilterNone = 0,
+    kNERtcVideoScaleFilterLinear = 1,
+    kNERtcVideoScaleFilterBilinear = 2,
+    kNERtcVideoScaleFilterBox = 3,
+    kNERtcVideoScaleFilterAuto = 4
+}
+/** 视频帧某一阶段的时延分布（ms） */
+export interface NERtcVideoLatencyHistogram {
+    count: number; /**< 样本数 */
+    mean: number; /**< 平均值 */
+    p50: number; /**< 50 分位 */
+    p90: number; /**< 90 分位 */
+    p99: number; /**< 99 分位 */
+    max: number; /**< 最大值，分位值超过 1000 时按 1000 计 */
+}
+/** 视频帧各阶段的时延统计 */
+export interface NERtcVideoLatencyStats {
+    arrive_to_deliver: NERtcVideoLatencyHistogram; /**< SDK 回调到达至投递给 JS */
+    deliver_to_render: NERtcVideoLatencyHistogram; /**< 投递给 JS 至渲染完成 */
+    arrive_to_render: NERtcVideoLatencyHistogram; /**< SDK 回调到达至渲染完成 */
+}
+/** 单路视频流在 native 投递链路上的统计 */
+export interface NERtcVideoTransportStats {
+    uid: number; /**< 用户 ID，0 表示本地 */
+    stream_type: NERtcStreamChannelType; /**< 视频流类型 */
+    channel_id: string; /**< 频道名 */
+    received_frames: number; /**< SDK 回调的帧数 */
+    suppressed_frames: number; /**< 重复帧抑制或脏块无变化而未投递的帧数 */
+    copied_frames: number; /**< 拷贝/转换进投递缓冲的帧数 */
+    scaled_frames: number; /**< 其中需要缩放的帧数 */
+    coalesced_frames: number; /**< 投递前被新帧覆盖而丢弃的帧数 */
+    delivered_frames: number; /**< 实际投递给 JS 的帧数 */
+    throttled_frames: number; /**< 被渲染频率调控跳过的帧数 */
+    hidden_frames: number; /**< 流不可见而跳过的帧数 */
+    received_fps: number; /**< 最近 1 秒的回调帧率 */
+    delivered_fps: number; /**< 最近 1 秒的投递帧率 */
+    copied_bytes: number; /**< 累计拷贝进投递缓冲的字节数 */
+    copy_time_us: number; /**< 平均每帧拷贝/缩放/转换耗时（微秒） */
+    buffer_bytes: number; /**< 该流当前占用的投递缓冲字节数 */
+}
+/** 视频流的渲染优先级 */
+export declare enum NERtcStreamRenderPriority {
+    kNERtcStreamRenderPriorityActiveSpeaker = 0,
+    kNERtcStreamRenderPriorityPinned = 1,
+    kNERtcStreamRenderPriorityVisible = 2,
+    kNERtcStreamRenderPriorityOffscreen = 3
+}
+/** 直播成员布局二进制编码的字段序号，第 i 个成员的第 field 项位于 data[i * kNERtcLiveStreamUserFieldCount + field]，见 encodeLiveStreamUsers */
+export declare enum NERtcLiveStreamUserField {
+    kNERtcLiveStreamUserUid = 0,
+    kNERtcLiveStreamUserVideoPush = 1,
+    kNERtcLiveStreamUserAdaption = 2,
+    kNERtcLiveStreamUserX = 3,
+    kNERtcLiveStreamUserY = 4,
+    kNERtcLiveStreamUserWidth = 5,
+    kNERtcLiveStreamUserHeight = 6,
+    kNERtcLiveStreamUserAudioPush = 7,
+    kNERtcLiveStreamUserZOrder = 8,
+    kNERtcLiveStreamUserFieldCount = 9
+}
@@ -1,6 +1,6 @@
 /// <reference types="node" />
 import { IRenderer } from '../renderer';
-import { NERtcEngineAPI, NERtcEngineContext, NERtcChannelProfileType, NERtcRemoteVideoStreamType, NERtcVideoCanvas, NERtcErrorCode, NERtcSessionLeaveReason, NERtcVideoProfileType, NERtcAudioProfileType, NERtcAudioScenarioType, NERtcVideoConfig, NERtcCreateAudioMixingOption, NERtcCreateAudioEffectOption, NERtcRectangle, NERtcScreenCaptureParameters, NERtcDevice, NERtcStats, NERtcAudioSendStats, NERtcAudioRecvStats, NERtcVideoSendStats, NERtcVideoRecvStats, NERtcNetworkQualityInfo, NERtcClientRole, NERtcConnectionStateType, NERtcReasonConnectionChangedType, NERtcAudioDeviceType, NERtcAudioDeviceState, NERtcAudioMixingState, NERtcAudioMixingErrorCode, NERtcAudioVolumeInfo, NERtcLiveStreamStateCode, NERtcLiveStreamTaskInfo, NERtcVideoMirrorMode, NERtcVideoScalingMode, NERtcVoiceChangerType, NERtcVoiceBeautifierType, NERtcVoiceEqualizationBand, NERtcStreamChannelType, NERtcPullExternalAudioFrameCb, NERtcAudioStreamType, NERtcVideoStreamType, NERtcInstallCastAudioDriverResult } from './defs';
+import { NERtcEngineAPI, NERtcEngineContext, NERtcChannelProfileType, NERtcRemoteVideoStreamType, NERtcVideoCanvas, NERtcErrorCode, NERtcSessionLeaveReason, NERtcVideoProfileType, NERtcAudioProfileType, NERtcAudioScenarioType, NERtcVideoConfig, NERtcCreateAudioMixingOption, NERtcCreateAudioEffectOption, NERtcRectangle, NERtcScreenCaptureParameters, NERtcDevice, NERtcStats, NERtcAudioSendStats, NERtcAudioRecvStats, NERtcVideoSendStats, NERtcVideoRecvStats, NERtcNetworkQualityInfo, NERtcClientRole, NERtcConnectionStateType, NERtcReasonConnectionChangedType, NERtcAudioDeviceType, NERtcAudioDeviceState, NERtcAudioMixingState, NERtcAudioMixingErrorCode, NERtcAudioVolumeInfo, NERtcLiveStreamStateCode, NERtcLiveStreamTaskInfo, NERtcVideoMirrorMode, NERtcVideoScalingMode, NERtcVoiceChangerType, NERtcVoiceBeautifierType, NERtcVoiceEqualizationBand, NERtcStreamChannelType, NERtcPullExternalAudioFrameCb, NERtcAudioStreamType, NERtcVideoStreamType, NERtcInstallCastAudioDriverResult, NERtcVideoDumpFormat, NERtcVideoOutputFormat, NERtcDuplicateFrameStats, NERtcVideoQualityReference, NERtcVideoQualityProbeStats, NERtcVideoScaleFilter, NERtcVideoLatencyStats, NERtcVideoTransportStats, NERtcStreamRenderPriority, NERtcLiveStreamUserTranscoding, NERtcLiveStreamUserField } from './defs';
 import { EventEmitter } from 'events';
 /**
  * @class NERtcEngine
@@ -11,6 +11,7 @@ declare class NERtcEngine extends EventEmitter {
     substreamRenderers: Map<string, IRenderer>;
     renderMode: 1 | 2 | 3;
     customRenderer: any;
+    latencyStatsEnabled: boolean;
     /**
      * NERtcEngine类构造函数
      * @returns {NERtcEngine}
@@ -1200,14 +1201,14 @@ declare class NERtcEngine extends EventEmitter {
      * - SEI 数据跟随视频帧发送，由于在弱网环境下可能丢帧，SEI 数据也可能随之丢失，所以建议在发送频率限制之内多次发送，保证接收端收到的概率。
      * - 调用本接口时，默认使用主流通道发送 SEI。
      * </pre>
-     * @param {ArrayBuffer} data 自定义 SEI 数据
+     * @param {ArrayBuffer | ArrayBufferView} data 自定义 SEI 数据，可传入 Uint8Array 等视图，按视图的 byteOffset 与 byteLength 发送，不会拷贝
      * @return {number}
      * <pre>
      * - 0: 方法调用成功；
      * - 其他: 方法调用失败。
      * </pre>
      */
-    sendSEIMsg(data: ArrayBuffer): number;
+    sendSEIMsg(data: ArrayBuffer | ArrayBufferView): number;
     /**
      * 发送媒体补充增强信息（SEI）。
      * @since 4.1.110
@@ -1221,7 +1222,7 @@ declare class NERtcEngine extends EventEmitter {
      * - SEI 数据跟随视频帧发送，由于在弱网环境下可能丢帧，SEI 数据也可能随之丢失，所以建议在发送频率限制之内多次发送，保证接收端收到的概率。
      * - 调用本接口时，默认使用主流通道发送 SEI。
      * </pre>
-     * @param {ArrayBuffer} data 自定义 SEI 数据
+     * @param {ArrayBuffer | ArrayBufferView} data 自定义 SEI 数据，可传入 Uint8Array 等视图，按视图的 byteOffset 与 byteLength 发送，不会拷贝
      * @param {number} type 发送 SEI 时，使用的流通道类型：
      * <pre>
      * - 0: 主流通道
@@ -1233,7 +1234,7 @@ declare class NERtcEngine extends EventEmitter {
      * - 其他: 方法调用失败。
      * </pre>
      */
-    sendSEIMsgEx(data: ArrayBuffer, type: NERtcStreamChannelType): number;
+    sendSEIMsgEx(data: ArrayBuffer | ArrayBufferView, type: NERtcStreamChannelType): number;
     /**
      * 拉取外部音频数据。
      * @since 4.1.110
@@ -1319,7 +1320,7 @@ declare class NERtcEngine extends EventEmitter {
      * @param {number} info.layout.height 视频推流高度
      * @param {number} info.layout.background_color 视频推流背景色，(R & 0xff) << 16 | (G & 0xff) << 8 | (B & 0xff)
      * @param {number} info.layout.user_count 成员布局个数
-     * @param {object[]} info.layout.users 成员布局数组:
+     * @param {object[]|Float64Array} info.layout.users 成员布局数组，也可以传入 encodeLiveStreamUsers 编码的 Float64Array:
      * @param {number} info.layout.users[].uid 用户id
      * @param {boolean} info.layout.users[].video_push 是否推送该用户视频流，info.ls_mode=1时无效
      * @param {number} info.layout.users[].adaption 视频流裁剪模式:
@@ -1362,7 +1363,7 @@ declare class NERtcEngine extends EventEmitter {
      * @param {number} info.layout.height 视频推流高度
      * @param {number} info.layout.background_color 视频推流背景色，(R & 0xff) << 16 | (G & 0xff) << 8 | (B & 0xff)
      * @param {number} info.layout.user_count 成员布局个数
-     * @param {object[]} info.layout.users 成员布局数组:
+     * @param {object[]|Float64Array} info.layout.users 成员布局数组，也可以传入 encodeLiveStreamUsers 编码的 Float64Array:
      * @param {number} info.layout.users[].uid 用户id
      * @param {boolean} info.layout.users[].video_push 是否推送该用户视频流，info.ls_mode=1时无效
      * @param {number} info.layout.users[].adaption 视频流裁剪模式:
@@ -1388,6 +1389,43 @@ declare class NERtcEngine extends EventEmitter {
      * </pre>
      */
     updateLiveStreamTask(info: NERtcLiveStreamTaskInfo): number;
+    /**
+     * 只修改直播推流任务中发生变化的成员布局，并作为一次任务更新提交。通话中有效。
+     * @since 4.1.113
+     * @fires NERtcEngine#onUpdateLiveStreamTask
+     * <pre>
+     * native 层保存了通过 addLiveStreamTask、updateLiveStreamTask 成功提交的任务，本接口在该副本上修改个别成员
+     * （移动、缩放、调整图层顺序、开关音视频推流、增删成员）后整体提交，不再从 JS 传入并转换完整的任务。
+     * - 按 uid 匹配成员，只修改给出的字段；uid 不在任务中时追加为新成员，未给出的字段取 0。
+     * - changes 也可以是 Float64Array，格式同 encodeLiveStreamUsers，值为 NaN 的字段保持不变。
+     * - 提交失败时 native 层的副本恢复为修改前的状态。
+     * - 任务须先通过 addLiveStreamTask 添加，removeLiveStreamTask、leaveChannel 后副本随之删除。
+     * </pre>
+     * @param {String} taskId 直播任务 id。
+     * @param {object[]|Float64Array} changes 发生变化的成员布局，每项须包含 uid，其余字段同 info.layout.users，均可省略。
+     * @param {number[]} [removedUids=[]] 需要移出布局的成员 uid。
+     * @returns {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败，包括任务不存在。
+     * </pre>
+     */
+    updateLiveStreamUsers(taskId: string, changes: Array<Partial<NERtcLiveStreamUserTranscoding>> | Float64Array, removedUids?: Array<number>): number;
+    /**
+     * 将成员布局数组编码为 Float64Array，可直接作为 addLiveStreamTask、updateLiveStreamTask 的 info.layout.users。
+     * @since 4.1.113
+     * <pre>
+     * 每个成员占一行，第 i 个成员的第 field 项位于 data[i * kNERtcLiveStreamUserFieldCount + field]，字段序号见 NERtcLiveStreamUserField。
+     * native 层按行直接读取，不再逐个成员、逐个字段查找属性，适用于频繁调整多人布局的混流场景。
+     * - 也可以自行维护这张表，只修改发生变化的成员所在的行后再次传入。
+     * - info.layout.user_count 须与表的行数一致。
+     * - 成员布局中的 bg_image 不参与编码，仍通过 info.layout.bg_image 设置。
+     * </pre>
+     * @param {object[]} users 成员布局数组，字段同 info.layout.users。
+     * @param {Float64Array} [out] 复用的输出表，长度与成员数匹配时直接写入，否则新建。
+     * @returns {Float64Array} 编码后的成员布局表。
+     */
+    encodeLiveStreamUsers(users: Array<NERtcLiveStreamUserTranscoding>, out?: Float64Array): Float64Array;
     /**
      * 删除房间推流任务。通话中有效。
      * @fires NERtcEngine#onRemoveLiveStreamTask
@@ -2027,6 +2065,535 @@ declare class NERtcEngine extends EventEmitter {
      */
     adjustUserPlaybackSignalVolume(uid: number, volume: number, streamType: NERtcAudioStreamType): number;
     checkNECastAudioDriver(): number;
+    /**
+     * 开始将指定视频流的帧数据写入本地文件。
+     * @since 4.1.113
+     * <pre>
+     * 用于测试和存档。帧数据在 native 层按原始分辨率写入，与渲染时的缩放无关，不经过 JS 回调。
+     * - 写文件在独立线程中进行，队列已满时直接丢弃新到的帧，不会阻塞视频回调。
+     * - 码流分辨率变化时会另起一个文件，文件名追加序号，如 dump_1.y4m。
+     * - Y4M 格式的帧率固定写为 30fps，播放时可按实际帧率覆盖。
+     * <b>NOTE:</b>
+     * - 需要先调用 setupVideoCanvas 或 setupSubStreamVideoCanvas 设置对应的画布。
+     * - 对同一路视频流重复调用会先结束上一次 dump。
+     * - 文件在调用时创建，路径不可写时返回失败，不会开始 dump。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {String} path 文件的完整路径，UTF-8 编码。
+     * @param {number} format 文件格式：
+     * <pre>
+     * - 0: 裸 I420 数据
+     * - 1: Y4M
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    startVideoFrameDump(uid: number, streamType: NERtcStreamChannelType, path: String, format: NERtcVideoDumpFormat): number;
+    /**
+     * 停止写入指定视频流的帧数据，并关闭文件。
+     * @since 4.1.113
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败，如该视频流未开启 dump。
+     * </pre>
+     */
+    stopVideoFrameDump(uid: number, streamType: NERtcStreamChannelType): number;
+    /**
+     * 开启或关闭 SEI 消息的批量投递。
+     * @since 4.1.113
+     * <pre>
+     * SDK 收到的 SEI 消息会先缓存在 native 层，每次 JS 线程空闲时一次性投递自上次投递以来收到的所有消息。
+     * - 开启后通过 onReceSEIMsgBatch 回调投递：所有消息的数据合并在一个 ArrayBuffer 中，并附带一个偏移表。
+     * - 关闭时（默认）仍通过 onReceSEIMsg 逐条回调，但同一批次的消息在同一个任务中投递。
+     * </pre>
+     * @param {boolean} enable 是否开启批量投递。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableSEIBatchDelivery(enable: boolean): number;
+    /**
+     * 设置 SEI 消息过滤条件。
+     * @since 4.1.113
+     * <pre>
+     * 过滤在 native 层完成，不满足条件的消息不会被拷贝，也不会投递到 JS。对 onReceSEIMsg、onReceSEIMsgBatch 与挂到视频帧上的 SEI（onVideoFrameSEI）均生效。
+     * </pre>
+     * @param {Array<number>} uids 只接收这些用户发送的 SEI，传 null 或空数组表示不过滤用户。
+     * @param {ArrayBuffer} prefix 只接收以该内容开头的 SEI，传 null 或空 ArrayBuffer 表示不过滤内容。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setSEIMessageFilter(uids: Array<number> | null, prefix: ArrayBuffer | null): number;
+    /**
+     * 开启或关闭 SEI 与视频帧的对齐。
+     * @since 4.1.113
+     * <pre>
+     * 开启后，远端用户的 SEI 会在 native 层挂到该用户主流随后投递的第一帧视频上，并在该帧绘制后立即通过 onVideoFrameSEI 回调抛出，
+     * 可直接用于逐帧叠加显示，无需在 JS 中按时间戳匹配。
+     * - 一帧上最多保留最近的 8 条 SEI。
+     * - 不影响 onReceSEIMsg 与 onReceSEIMsgBatch 回调。
+     * </pre>
+     * @param {boolean} enable 是否开启。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableVideoFrameSEIAttachment(enable: boolean): number;
+    /**
+     * 批量发送媒体补充增强信息（SEI）。
+     * @since 4.1.113
+     * <pre>
+     * 消息在 native 层排队，并按 setSEISendRate 设置的频率（默认 10 条/秒）逐条发送，避免超出 SDK 的发送频率限制导致 SEI 被丢弃。
+     * - 每条 SEI 最大 4096 字节，任意一条不合法时整批都不会发送。
+     * - 队列最多缓存 64 条，超出部分不会入队，可根据返回值判断实际入队条数。
+     * - SDK 返回发送失败时会在下个周期重试，最多 3 次。
+     * </pre>
+     * @param {Array<ArrayBuffer | ArrayBufferView>} messages 待发送的 SEI 数据列表
+     * @param {number} type 发送 SEI 时，使用的流通道类型：
+     * <pre>
+     * - 0: 主流通道
+     * - 1: 辅流通道
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 大于等于 0: 成功入队的条数；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    sendSEIMsgBatch(messages: Array<ArrayBuffer | ArrayBufferView>, type: NERtcStreamChannelType): number;
+    /**
+     * 设置批量发送 SEI 的频率上限。
+     * @since 4.1.113
+     * <pre>
+     * 该频率不应超过视频发送帧率，建议不超过 10 次/秒。仅对 sendSEIMsgBatch 生效。
+     * </pre>
+     * @param {number} rate 每秒最多发送的条数，需大于 0。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setSEISendRate(rate: number): number;
+    /**
+     * 开启或关闭统计信息快照。
+     * @since 4.1.113
+     * <pre>
+     * 开启后，远端音频、远端视频统计与网络质量不再通过 onRemoteAudioStats、onRemoteVideoStats、onNetworkQuality 以对象数组的形式回调，
+     * 而是在 native 层写入预分配的按列存放的表，整张表以一个 Float64Array 通过 onRemoteAudioStatsSnapshot、onRemoteVideoStatsSnapshot、
+     * onNetworkQualitySnapshot 回调，适用于大房间中减少每秒数百次的属性设置与对象分配。
+     * - 第 column 列第 row 行的值为 data[column * rows + row]，列序号见 NERtcRemoteAudioStatsColumn、NERtcRemoteVideoStatsColumn、NERtcNetworkQualityColumn。
+     * - 快照只包含数值字段，不包含 codec_name。
+     * - JS 线程来不及处理时只保留最新一份快照。
+     * </pre>
+     * @param {boolean} enable 是否开启：
+     * <pre>
+     * - true: 开启。
+     * - false: 关闭（默认），使用原有的对象数组回调。
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableStatsSnapshot(enable: boolean): number;
+    /**
+     * 设置指定视频流投递给渲染器的帧格式。
+     * @since 4.1.113
+     * <pre>
+     * 默认投递平面 I420 数据，由渲染器自行转换为 RGB。设置为 RGBA/BGRA 后，颜色转换在 native 层完成，
+     * 投递的帧只有一个平面（ydata），udata 与 vdata 为空，格式写在帧头的 format 字段中。
+     * - RGBA 适用于 SoftwareRenderer：直接通过 putImageData 绘制，不再在 JS 中逐像素转换，适合无 GPU 的环境。
+     * - BGRA 供自定义渲染器使用，SDK 自带的渲染器不支持。
+     * - NV12 适用于 GlRenderer：色度平面交错存放，每帧只需上传两张纹理。
+     * - NV12 输出的宽高取不大于原尺寸的偶数，奇数宽高的画面会缩小 1 像素。
+     * - GlRenderer 支持 I420 与 NV12，SoftwareRenderer 支持 I420 与 RGBA。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {number} format 帧格式：
+     * <pre>
+     * - 0: I420（默认）
+     * - 1: RGBA
+     * - 2: BGRA
+     * - 3: NV12
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setVideoOutputFormat(uid: number, streamType: NERtcStreamChannelType, format: NERtcVideoOutputFormat): number;
+    /**
+     * 开启或关闭指定视频流的重复帧抑制。
+     * @since 4.1.113
+     * <pre>
+     * 开启后，native 层对每一帧按行抽样计算哈希，与上一次投递的帧相同时直接跳过拷贝与投递。
+     * 适用于内容长时间静止的屏幕共享辅流，可省去大部分渲染开销。
+     * - 抽样的行之外发生的变化可能在 refreshInterval 内不被察觉，超过 refreshInterval 会强制投递一次。
+     * - 设置渲染尺寸或帧格式后会重新比较。
+     * - 不影响 startVideoFrameDump 写入的帧。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {boolean} enable 是否开启。
+     * @param {number} [sampleStep=4] 每隔多少行取一行参与哈希，1 表示整帧参与。
+     * @param {number} [refreshInterval=1000] 强制刷新间隔（ms）。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableDuplicateFrameSuppression(uid: number, streamType: NERtcStreamChannelType, enable: boolean, sampleStep?: number, refreshInterval?: number): number;
+    /**
+     * 获取指定视频流的重复帧抑制统计。
+     * @since 4.1.113
+     * <pre>
+     * 统计在每次调用 enableDuplicateFrameSuppression 时清零。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @return {object} 统计信息：
+     * <pre>
+     * - checked_frames {number} 参与比较的帧数
+     * - skipped_frames {number} 跳过投递的帧数
+     * </pre>
+     */
+    getDuplicateFrameStats(uid: number, streamType: NERtcStreamChannelType): NERtcDuplicateFrameStats;
+    /**
+     * 开启或关闭指定视频流的脏块投递。
+     * @since 4.1.113
+     * <pre>
+     * 开启后，native 层把帧按 tileSize × tileSize 分块，与上一帧逐块比较，只把发生变化的块打包投递给 JS，
+     * 由 GlRenderer 通过 texSubImage2D 更新到已有纹理上，适用于大部分内容静止的屏幕共享辅流。
+     * - 仅对 I420 输出格式生效，SoftwareRenderer 与自定义渲染器会收到带 dirtyTiles 字段的帧，需自行忽略或处理。
+     * - 首帧、尺寸变化、变化块超过一半或距上次完整帧超过 refreshInterval 时投递完整帧。
+     * - 没有任何块变化时不投递。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {boolean} enable 是否开启。
+     * @param {number} [tileSize=64] 块边长（像素），取值为 16 的倍数，范围 16 ~ 256。
+     * @param {number} [refreshInterval=2000] 完整帧刷新间隔（ms）。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableDirtyTileDelivery(uid: number, streamType: NERtcStreamChannelType, enable: boolean, tileSize?: number, refreshInterval?: number): number;
+    /**
+     * 开启或关闭指定视频流的画质探测。
+     * @since 4.1.113
+     * <pre>
+     * 开启后每隔 interval 帧拷贝一份源帧与投递帧，在独立线程中按参考路径生成参考帧并计算 I420 PSNR/SSIM，
+     * 可用于评估 setVideoDimension 缩放与滤波档位带来的画质损失。计算线程繁忙时直接丢弃采样，不影响渲染。
+     * - 投递帧为 I420 输出时取居中后的画面，其他输出格式取格式转换前的缩放结果。
+     * - 只衡量渲染路径上的缩放损失，无法衡量解码损失。
+     * - 重新开启会清空统计。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {boolean} enable 是否开启。
+     * @param {number} [interval=30] 采样间隔（帧）。
+     * @param {number} [reference=0] 参考路径：
+     * <pre>
+     * - 0: 投递帧放大回源分辨率后与源帧比较
+     * - 1: 源帧以 box 滤波缩放到投递分辨率后与投递帧比较
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableVideoQualityProbe(uid: number, streamType: NERtcStreamChannelType, enable: boolean, interval?: number, reference?: NERtcVideoQualityReference): number;
+    /**
+     * 获取指定视频流的画质探测统计。
+     * @since 4.1.113
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @return {object} 统计信息，未开启探测时各项为 0：
+     * <pre>
+     * - samples {number} 已完成计算的采样数
+     * - dropped {number} 计算线程繁忙时丢弃的采样数
+     * - psnr {number} 最近 30 个采样的平均 PSNR（dB），完全一致时为 128
+     * - ssim {number} 最近 30 个采样的平均 SSIM
+     * - last_psnr {number} 最近一次采样的 PSNR（dB）
+     * - last_ssim {number} 最近一次采样的 SSIM
+     * - min_psnr {number} 最近 30 个采样中最低的 PSNR（dB）
+     * </pre>
+     */
+    getVideoQualityProbeStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoQualityProbeStats;
+    /**
+     * 设置指定视频流渲染缩放使用的滤波档位。
+     * @since 4.1.113
+     * <pre>
+     * 仅在通过 setVideoDimension 等方式设置了与源帧不同的渲染尺寸时生效。
+     * 默认为自动档位：缩小不超过一半或放大时使用双线性，缩小超过一半时使用 box；
+     * 单帧缩放耗时超过 setVideoScaleCpuBudget 设置的预算时逐级降档，之后每 300 帧尝试回升一档。
+     * 各档位的耗时参考 README 中的“视频缩放滤波档位参考”。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {number} filter 滤波档位：
+     * <pre>
+     * - 0: 最近邻
+     * - 1: 水平线性
+     * - 2: 双线性
+     * - 3: box
+     * - 4: 自动
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setVideoScaleFilter(uid: number, streamType: NERtcStreamChannelType, filter: NERtcVideoScaleFilter): number;
+    /**
+     * 设置自动滤波档位的单帧缩放耗时预算。
+     * @since 4.1.113
+     * <pre>
+     * 对所有处于自动档位的视频流生效，默认 2000 微秒。
+     * </pre>
+     * @param {number} budgetUs 单帧缩放耗时预算（微秒）。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setVideoScaleCpuBudget(budgetUs: number): number;
+    /**
+     * 开启或关闭视频帧时延统计。
+     * @since 4.1.113
+     * <pre>
+     * 视频帧头中的 timestamp 为帧到达 native 层时的单调时钟毫秒值（32 位），投递给 JS 时 native 记录投递时间，
+     * 开启后 SDK 自带的渲染器绘制完成时回报渲染时间，native 按流统计到达→投递→渲染各阶段的时延分布。
+     * - 使用自定义渲染器时需自行调用 reportVideoFrameRendered 回报。
+     * - 重新开启会清空已有统计。
+     * </pre>
+     * @param {boolean} enable 是否开启。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableVideoLatencyStats(enable: boolean): number;
+    /**
+     * 回报视频帧渲染完成。
+     * @since 4.1.113
+     * <pre>
+     * 供自定义渲染器在绘制完成后调用，SDK 自带的渲染器会自动回报。未开启 enableVideoLatencyStats 时忽略。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {number} timestamp 帧头中的 timestamp，即 new DataView(header).getUint32(16)。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    reportVideoFrameRendered(uid: number, streamType: NERtcStreamChannelType, timestamp: number): number;
+    /**
+     * 获取指定视频流的时延统计。
+     * @since 4.1.113
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @return {object} 时延统计，每项包含 count、mean、p50、p90、p99、max（ms）：
+     * <pre>
+     * - arrive_to_deliver {object} SDK 回调到达至投递给 JS
+     * - deliver_to_render {object} 投递给 JS 至渲染完成
+     * - arrive_to_render {object} SDK 回调到达至渲染完成
+     * </pre>
+     */
+    getVideoLatencyStats(uid: number, streamType: NERtcStreamChannelType): NERtcVideoLatencyStats;
+    /**
+     * 获取所有视频流在 native 投递链路上的统计。
+     * @since 4.1.113
+     * <pre>
+     * 计数自该流第一次收到帧起累计，可用于定位帧在 回调→拷贝→投递 各环节的去向与 CPU 开销。
+     * 帧率按 1 秒窗口统计，超过 2 秒没有帧时为 0。
+     * </pre>
+     * @return {object[]} 每路视频流一项：
+     * <pre>
+     * - uid {number} 用户 ID，0 表示本地
+     * - stream_type {number} 视频流类型，0: 主流，1: 辅流
+     * - channel_id {string} 频道名
+     * - received_frames {number} SDK 回调的帧数
+     * - suppressed_frames {number} 重复帧抑制或脏块无变化而未投递的帧数
+     * - copied_frames {number} 拷贝/转换进投递缓冲的帧数
+     * - scaled_frames {number} 其中需要缩放的帧数
+     * - coalesced_frames {number} 投递前被新帧覆盖而丢弃的帧数
+     * - delivered_frames {number} 实际投递给 JS 的帧数
+     * - throttled_frames {number} 被渲染频率调控跳过的帧数
+     * - hidden_frames {number} 流不可见而跳过的帧数
+     * - received_fps {number} 回调帧率
+     * - delivered_fps {number} 投递帧率
+     * - copied_bytes {number} 累计拷贝字节数
+     * - copy_time_us {number} 平均每帧拷贝/缩放/转换耗时（微秒）
+     * - buffer_bytes {number} 当前占用的投递缓冲字节数
+     * </pre>
+     */
+    getVideoTransportStats(): Array<NERtcVideoTransportStats>;
+    /**
+     * 设置视频流的渲染优先级。
+     * @since 4.1.113
+     * <pre>
+     * native 层每秒按优先级与 setVideoRenderBudget 设置的全局预算为各路视频流分配投递帧率，
+     * 超出分配帧率的帧在拷贝前直接跳过，被跳过的帧数见 getVideoTransportStats 的 throttled_frames。
+     * - 预算按优先级从高到低依次满足，不足时当前档位内各流等比例降低帧率，更低档位只保留 1 帧/秒。
+     * - 不可见画面无论预算如何最多 2 帧/秒。
+     * - 默认所有流均为普通可见画面。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {number} priority 渲染优先级：
+     * <pre>
+     * - 0: 当前说话者
+     * - 1: 固定显示
+     * - 2: 普通可见
+     * - 3: 不可见
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setStreamRenderPriority(uid: number, streamType: NERtcStreamChannelType, priority: NERtcStreamRenderPriority): number;
+    /**
+     * 设置所有视频流投递的全局预算。
+     * @since 4.1.113
+     * <pre>
+     * 预算为每秒拷贝投递给 JS 的总像素数（按投递分辨率计），例如 1280x720 15 帧/秒约为 13824000。
+     * 默认 0 表示不限，此时只对不可见画面限制帧率。
+     * </pre>
+     * @param {number} pixelsPerSecond 每秒投递的总像素数，0 表示不限。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setVideoRenderBudget(pixelsPerSecond: number): number;
+    /**
+     * 设置视频流在界面上是否可见。
+     * @since 4.1.113
+     * <pre>
+     * 窗口最小化、画面滚出可视区域或被遮挡时可设为不可见，native 层对该流的帧不再拷贝和投递，只保留最后一帧；
+     * 重新设为可见时立即补投这一帧，无需等待下一帧到达即可恢复画面。
+     * - thumbnailInterval 不为 0 时，不可见期间仍按该间隔投递缩小为 1/thumbnailScale 的缩略帧，可用于画廊预览；重新可见时补投的仍是隐藏前最后一帧完整画面。
+     * - 不可见期间跳过的帧数见 getVideoTransportStats 的 hidden_frames。
+     * - 不可见的流在渲染频率调控中不占用预算（有缩略帧时按缩略帧的帧率计）。
+     * - 默认所有流均可见。
+     * </pre>
+     * @param {number} uid 用户 ID，0 表示本地视频。
+     * @param {number} streamType 视频流类型：
+     * <pre>
+     * - 0: 主流
+     * - 1: 辅流
+     * </pre>
+     * @param {boolean} visible 是否可见。
+     * @param {number} [thumbnailInterval=0] 不可见时缩略帧的投递间隔（毫秒），0 表示不投递，例如 1000 为 1 帧/秒。
+     * @param {number} [thumbnailScale=4] 缩略帧宽高缩小的倍数。
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    setStreamVisibility(uid: number, streamType: NERtcStreamChannelType, visible: boolean, thumbnailInterval?: number, thumbnailScale?: number): number;
+    /**
+     * 开启或关闭按需取值的通话统计对象。
+     * @since 4.1.113
+     * <pre>
+     * 开启后，onRtcStats 回调的对象只持有一份 native 统计快照，各字段在首次读取时才转换为 JS 值，
+     * 回调的开销与实际读取的字段数成正比，适用于只关心少数几个字段（如 cpu_app_usage、rx_bytes）的场景。
+     * - 字段名与取值与关闭时一致，Object.keys、JSON.stringify 等可正常使用。
+     * - native 快照在对象被垃圾回收时释放，长期持有回调对象会延后释放。
+     * - 默认关闭。
+     * </pre>
+     * @param {boolean} enable 是否开启：
+     * <pre>
+     * - true: 开启。
+     * - false: 关闭（默认），回调时完整转换全部字段。
+     * </pre>
+     * @return {number}
+     * <pre>
+     * - 0: 方法调用成功；
+     * - 其他: 方法调用失败。
+     * </pre>
+     */
+    enableLazyStats(enable: boolean): number;
     /**
      * init event handler
      * @private
@@ -2270,6 +2837,24 @@ declare interface NERtcEngine {
      @param user_count infos 数组的大小，即用户数。
      */
     on(event: 'onNetworkQuality', cb: (uc: number, stats: NERtcNetworkQualityInfo) => void): this;
+    /** 远端音频统计快照回调，需先调用 enableStatsSnapshot 开启。
+
+     * @param rows 行数，每行对应一个远端用户
+     * @param data 按列存放的统计表，第 column 列第 row 行为 data[column * rows + row]，列序号见 NERtcRemoteAudioStatsColumn
+     */
+    on(event: 'onRemoteAudioStatsSnapshot', cb: (rows: number, data: Float64Array) => void): this;
+    /** 远端视频统计快照回调，需先调用 enableStatsSnapshot 开启。
+
+     * @param rows 行数，每行对应一个远端用户的一个视频流 layer
+     * @param data 按列存放的统计表，第 column 列第 row 行为 data[column * rows + row]，列序号见 NERtcRemoteVideoStatsColumn
+     */
+    on(event: 'onRemoteVideoStatsSnapshot', cb: (rows: number, data: Float64Array) => void): this;
+    /** 网络质量快照回调，需先调用 enableStatsSnapshot 开启。
+
+     * @param rows 行数，每行对应一个用户
+     * @param data 按列存放的统计表，第 column 列第 row 行为 data[column * rows + row]，列序号见 NERtcNetworkQualityColumn
+     */
+    on(event: 'onNetworkQualitySnapshot', cb: (rows: number, data: Float64Array) => void): this;
     /** 远端用户开启辅流视频回调。
 
      @param uid 远端用户ID。
@@ -2450,6 +3035,22 @@ declare interface NERtcEngine {
      * @param data 接收到的 sei 数据
      */
     on(event: 'onReceSEIMsg', cb: (uid: number, data: ArrayBuffer) => void): this;
+    /** 批量收到远端流的 SEI 内容回调。
+
+     * @param data 自上次回调以来收到的所有 sei 数据
+     * @param table 偏移表，每条消息占 3 项：[uid, offset, length]
+     */
+    on(event: 'onReceSEIMsgBatch', cb: (data: ArrayBuffer, table: Float64Array) => void): this;
+    /** 与视频帧对齐的 SEI 回调，需先调用 enableVideoFrameSEIAttachment 开启。
+
+     该回调在对应视频帧绘制后同步触发。
+
+     * @param uid 发送该 sei 的用户 id
+     * @param type 视频帧类型
+     * @param sei 挂在该帧上的 sei 数据，按接收顺序排列
+     * @param channelId 该帧所属的频道名
+     */
+    on(event: 'onVideoFrameSEI', cb: (uid: number, type: number, sei: Array<ArrayBuffer>, channelId: string) => void): this;
     /** 安装声卡回调。
 
      @param result  返回结果。
@@ -11,6 +11,7 @@ interface IRenderer {
         yUint8Array: any;
         uUint8Array: any;
         vUint8Array: any;
+        dirtyTiles?: any;
     }): void;
     setContentMode(mode: number): void;
     refreshCanvas(): void;
@@ -28,6 +29,7 @@ declare class GlRenderer implements IRenderer {
         yUint8Array: any;
         uUint8Array: any;
         vUint8Array: any;
+        dirtyTiles?: any;
     }): void;
     setContentMode(mode: number): void;
     refreshCanvas(): any;
@@ -44,6 +46,7 @@ declare class CustomRenderer implements IRenderer {
         yUint8Array: any;
         uUint8Array: any;
         vUint8Array: any;
+        dirtyTiles?: any;
     }): void;
     setContentMode(mode: number): void;
     refreshCanvas(): void;